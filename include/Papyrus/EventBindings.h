@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Serialization/ConditionalEvents.h"
+#include "Serialization/Events.h"
+
+
+// generic RegisterFor/UnregisterFor natives for events with a binding in Serialization::EVENTS
+namespace EventBindings
+{
+	using VM = RE::BSScript::IVirtualMachine;
+	using StackID = RE::VMStackID;
+	using Severity = RE::BSScript::ErrorLogger::Severity;
+	using EVENT = Serialization::EVENT;
+
+
+	// script object policies : papyrus parameter type + validation
+	struct Form
+	{
+		using type = const RE::TESForm*;
+
+		static type Get(VM* a_vm, StackID a_stackID, type a_form)
+		{
+			if (!a_form) {
+				a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
+			}
+			return a_form;
+		}
+	};
+
+
+	struct Alias
+	{
+		using type = const RE::BGSBaseAlias*;
+
+		static type Get(VM* a_vm, StackID a_stackID, type a_alias)
+		{
+			if (!a_alias) {
+				a_vm->TraceStack("Alias is None", a_stackID, Severity::kWarning);
+			}
+			return a_alias;
+		}
+	};
+
+
+	struct RefAlias
+	{
+		using type = RE::BGSRefAlias*;
+
+		static type Get(VM* a_vm, StackID a_stackID, type a_alias)
+		{
+			if (!a_alias) {
+				a_vm->TraceStack("Reference Alias is None", a_stackID, Severity::kWarning);
+			}
+			return a_alias;
+		}
+	};
+
+
+	// declared as Alias in papyrus, but only reference aliases can receive actor events
+	struct AliasAsRefAlias
+	{
+		using type = const RE::BGSBaseAlias*;
+
+		static RE::BGSRefAlias* Get(VM* a_vm, StackID a_stackID, type a_alias)
+		{
+			if (!a_alias) {
+				a_vm->TraceStack("Alias is None", a_stackID, Severity::kWarning);
+				return nullptr;
+			}
+
+			auto refAlias = skyrim_cast<RE::BGSRefAlias*>(a_alias);
+			if (!refAlias) {
+				a_vm->TraceStack("Alias is not a reference alias", a_stackID, Severity::kWarning);
+			}
+			return refAlias;
+		}
+	};
+
+
+	template <class T>
+	struct BasicActiveEffect
+	{
+		using type = T*;
+
+		static type Get(VM* a_vm, StackID a_stackID, type a_activeEffect)
+		{
+			if (!a_activeEffect) {
+				a_vm->TraceStack("Active Effect is None", a_stackID, Severity::kWarning);
+			}
+			return a_activeEffect;
+		}
+	};
+
+	using ActiveEffect = BasicActiveEffect<const RE::ActiveEffect>;
+	using MutableActiveEffect = BasicActiveEffect<RE::ActiveEffect>;
+
+
+	template <EVENT E, class P>
+	void RegisterFor(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, typename P::type a_object)
+	{
+		if (const auto object = P::Get(a_vm, a_stackID, a_object); object) {
+			Serialization::Registration<E>::GetSingleton()->Register(object);
+		}
+	}
+
+
+	template <EVENT E, class P>
+	void RegisterForConditional(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, typename P::type a_object, std::vector<RE::BSFixedString> a_conditionList)
+	{
+		if (const auto object = P::Get(a_vm, a_stackID, a_object); object) {
+			if (!Serialization::ConditionalRegistration<E>::GetSingleton()->Register(object, a_conditionList)) {
+				a_vm->TraceStack("Failed to parse condition list", a_stackID, Severity::kWarning);
+			}
+		}
+	}
+
+
+	// also drops the object's conditional registrations
+	template <EVENT E, class P>
+	void UnregisterFor(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, typename P::type a_object)
+	{
+		if (const auto object = P::Get(a_vm, a_stackID, a_object); object) {
+			Serialization::Registration<E>::GetSingleton()->Unregister(object);
+			if constexpr (Serialization::HasConditions(E)) {
+				Serialization::ConditionalRegistration<E>::GetSingleton()->Unregister(object);
+			}
+		}
+	}
+
+
+	template <EVENT E, class P, class Filter>
+	void RegisterForFiltered(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, typename P::type a_object, Filter a_filter)
+	{
+		if (const auto object = P::Get(a_vm, a_stackID, a_object); object) {
+			Serialization::Registration<E>::GetSingleton()->Register(object, a_filter);
+		}
+	}
+
+
+	template <EVENT E, class P, class Filter>
+	void UnregisterForFiltered(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, typename P::type a_object, Filter a_filter)
+	{
+		if (const auto object = P::Get(a_vm, a_stackID, a_object); object) {
+			Serialization::Registration<E>::GetSingleton()->Unregister(object, a_filter);
+		}
+	}
+
+
+	template <class P, EVENT... E>
+	void Bind(VM* a_vm, std::string_view a_className)
+	{
+		static_assert(((!Serialization::EVENTS[to_underlying(E)].binding.empty()) && ...), "event has no default bindings");
+
+		const auto bind = [&](EVENT a_event, auto a_register, auto a_unregister) {
+			const std::string binding{ Serialization::EVENTS[to_underlying(a_event)].binding };
+
+			a_vm->RegisterFunction("RegisterFor" + binding, a_className, a_register, true);
+			a_vm->RegisterFunction("UnregisterFor" + binding, a_className, a_unregister, true);
+		};
+		(bind(E, RegisterFor<E, P>, UnregisterFor<E, P>), ...);
+	}
+
+
+	// RegisterFor/UnregisterFor natives taking one extra filter argument
+	template <class P, EVENT E, class Filter>
+	void BindFiltered(VM* a_vm, std::string_view a_className)
+	{
+		static_assert(!Serialization::EVENTS[to_underlying(E)].binding.empty(), "event has no default bindings");
+
+		const std::string binding{ Serialization::EVENTS[to_underlying(E)].binding };
+
+		a_vm->RegisterFunction("RegisterFor" + binding, a_className, RegisterForFiltered<E, P, Filter>, true);
+		a_vm->RegisterFunction("UnregisterFor" + binding, a_className, UnregisterForFiltered<E, P, Filter>, true);
+	}
+
+
+	// RegisterFor<binding>WithConditions natives, unregistered through the plain UnregisterFor natives
+	template <class P, EVENT... E>
+	void BindConditional(VM* a_vm, std::string_view a_className)
+	{
+		static_assert((Serialization::HasConditions(E) && ...), "event can't be registered for with conditions");
+		static_assert(((!Serialization::EVENTS[to_underlying(E)].binding.empty()) && ...), "event has no default bindings");
+
+		const auto bind = [&](EVENT a_event, auto a_register) {
+			const std::string binding{ Serialization::EVENTS[to_underlying(a_event)].binding };
+
+			a_vm->RegisterFunction("RegisterFor" + binding + "WithConditions", a_className, a_register, true);
+		};
+		(bind(E, RegisterForConditional<E, P>), ...);
+	}
+}
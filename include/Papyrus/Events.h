@@ -1,347 +1,130 @@
 #pragma once
 
+#include "Serialization/ConditionalEvents.h"
+#include "Serialization/Events.h"
 
-namespace ScriptEvents
-{
-	class CellFullyLoadedEventHandler : public RE::BSTEventSink<RE::TESCellFullyLoadedEvent>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static CellFullyLoadedEventHandler* GetSingleton();
 
-		virtual EventResult ProcessEvent(const RE::TESCellFullyLoadedEvent* a_event, RE::BSTEventSource<RE::TESCellFullyLoadedEvent>* a_dispatcher) override;
-
-	private:
-		CellFullyLoadedEventHandler() = default;
-		CellFullyLoadedEventHandler(const CellFullyLoadedEventHandler&) = delete;
-		CellFullyLoadedEventHandler(CellFullyLoadedEventHandler&&) = delete;
-		virtual ~CellFullyLoadedEventHandler() = default;
-
-		CellFullyLoadedEventHandler& operator=(const CellFullyLoadedEventHandler&) = delete;
-		CellFullyLoadedEventHandler& operator=(CellFullyLoadedEventHandler&&) = delete;
-	};
+namespace EventSinks
+{
+	using EVENT = Serialization::EVENT;
 
 
-	class QuestStartStopEventHandler : public RE::BSTEventSink<RE::TESQuestStartStopEvent>
+	// sink for one game event feeding one or more registrations
+	// events are dropped before any lookups unless a script is listening
+	template <class T, EVENT... E>
+	class EventHandler : public RE::BSTEventSink<T>
 	{
 	public:
 		using EventResult = RE::BSEventNotifyControl;
 
-		static QuestStartStopEventHandler* GetSingleton();
+		static EventHandler* GetSingleton()
+		{
+			static EventHandler singleton;
+			return &singleton;
+		}
 
-		virtual EventResult ProcessEvent(const RE::TESQuestStartStopEvent* a_event, RE::BSTEventSource<RE::TESQuestStartStopEvent>* a_dispatcher) override;
+		virtual EventResult ProcessEvent(const T* a_event, RE::BSTEventSource<T>*) override
+		{
+			if (a_event && HasListeners()) {
+				Dispatch(*a_event);
+			}
+			return EventResult::kContinue;
+		}
 
 	private:
-		QuestStartStopEventHandler() = default;
-		QuestStartStopEventHandler(const QuestStartStopEventHandler&) = delete;
-		QuestStartStopEventHandler(QuestStartStopEventHandler&&) = delete;
-		virtual ~QuestStartStopEventHandler() = default;
-
-		QuestStartStopEventHandler& operator=(const QuestStartStopEventHandler&) = delete;
-		QuestStartStopEventHandler& operator=(QuestStartStopEventHandler&&) = delete;
-	};
+		EventHandler() = default;
+		EventHandler(const EventHandler&) = delete;
+		EventHandler(EventHandler&&) = delete;
+		virtual ~EventHandler() = default;
 
+		EventHandler& operator=(const EventHandler&) = delete;
+		EventHandler& operator=(EventHandler&&) = delete;
 
-	class QuestStageEventHandler : public RE::BSTEventSink<RE::TESQuestStageEvent>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
+		static bool HasListeners()
+		{
+			return (HasListeners<E>() || ...);
+		}
 
-		static QuestStageEventHandler* GetSingleton();
 
-		virtual EventResult ProcessEvent(const RE::TESQuestStageEvent* a_event, RE::BSTEventSource<RE::TESQuestStageEvent>* a_dispatcher) override;
+		// scripts registered with conditions only are in the conditional registration
+		template <EVENT Ev>
+		static bool HasListeners()
+		{
+			if constexpr (Serialization::HasConditions(Ev)) {
+				if (!Serialization::ConditionalRegistration<Ev>::GetSingleton()->Empty()) {
+					return true;
+				}
+			}
+			return !Serialization::Registration<Ev>::GetSingleton()->Empty();
+		}
 
-	private:
-		QuestStageEventHandler() = default;
-		QuestStageEventHandler(const QuestStageEventHandler&) = delete;
-		QuestStageEventHandler(QuestStageEventHandler&&) = delete;
-		virtual ~QuestStageEventHandler() = default;
-
-		QuestStageEventHandler& operator=(const QuestStageEventHandler&) = delete;
-		QuestStageEventHandler& operator=(QuestStageEventHandler&&) = delete;
+		static void Dispatch(const T& a_event);
 	};
+}
 
 
-	class ObjectLoadedEventHandler : public RE::BSTEventSink<RE::TESObjectLoadedEvent>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static ObjectLoadedEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::TESObjectLoadedEvent* a_event, RE::BSTEventSource<RE::TESObjectLoadedEvent>* a_dispatcher) override;
-
-	private:
-		ObjectLoadedEventHandler() = default;
-		ObjectLoadedEventHandler(const ObjectLoadedEventHandler&) = delete;
-		ObjectLoadedEventHandler(ObjectLoadedEventHandler&&) = delete;
-		virtual ~ObjectLoadedEventHandler() = default;
-
-		ObjectLoadedEventHandler& operator=(const ObjectLoadedEventHandler&) = delete;
-		ObjectLoadedEventHandler& operator=(ObjectLoadedEventHandler&&) = delete;
-	};
-
-
-	class GrabReleaseEventHandler : public RE::BSTEventSink<RE::TESGrabReleaseEvent>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static GrabReleaseEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::TESGrabReleaseEvent* a_event, RE::BSTEventSource<RE::TESGrabReleaseEvent>* a_dispatcher) override;
-
-	private:
-		GrabReleaseEventHandler() = default;
-		GrabReleaseEventHandler(const GrabReleaseEventHandler&) = delete;
-		GrabReleaseEventHandler(GrabReleaseEventHandler&&) = delete;
-		virtual ~GrabReleaseEventHandler() = default;
-
-		GrabReleaseEventHandler& operator=(const GrabReleaseEventHandler&) = delete;
-		GrabReleaseEventHandler& operator=(GrabReleaseEventHandler&&) = delete;
-	};
+namespace ScriptEvents
+{
+	using CellFullyLoadedEventHandler = EventSinks::EventHandler<RE::TESCellFullyLoadedEvent, EventSinks::EVENT::kCellFullyLoaded>;
+	using QuestStartStopEventHandler = EventSinks::EventHandler<RE::TESQuestStartStopEvent, EventSinks::EVENT::kQuestStart, EventSinks::EVENT::kQuestStop>;
+	using QuestStageEventHandler = EventSinks::EventHandler<RE::TESQuestStageEvent, EventSinks::EVENT::kQuestStage>;
+	using ObjectLoadedEventHandler = EventSinks::EventHandler<RE::TESObjectLoadedEvent, EventSinks::EVENT::kObjectLoaded, EventSinks::EVENT::kObjectUnloaded>;
+	using GrabReleaseEventHandler = EventSinks::EventHandler<RE::TESGrabReleaseEvent, EventSinks::EVENT::kGrab, EventSinks::EVENT::kRelease>;
 }
 
 
 namespace StoryEvents
 {
-	class ActorKillEventHandler : public RE::BSTEventSink<RE::ActorKill::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static ActorKillEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::ActorKill::Event* a_event, RE::BSTEventSource<RE::ActorKill::Event>* a_dispatcher) override;
-
-	private:
-		ActorKillEventHandler() = default;
-		ActorKillEventHandler(const ActorKillEventHandler&) = delete;
-		ActorKillEventHandler(ActorKillEventHandler&&) = delete;
-		virtual ~ActorKillEventHandler() = default;
-
-		ActorKillEventHandler& operator=(const ActorKillEventHandler&) = delete;
-		ActorKillEventHandler& operator=(ActorKillEventHandler&&) = delete;
-	};
-
-
-	class BooksReadEventHandler : public RE::BSTEventSink<RE::BooksRead::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static BooksReadEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::BooksRead::Event* a_event, RE::BSTEventSource<RE::BooksRead::Event>* a_dispatcher) override;
-
-	private:
-		BooksReadEventHandler() = default;
-		BooksReadEventHandler(const BooksReadEventHandler&) = delete;
-		BooksReadEventHandler(BooksReadEventHandler&&) = delete;
-		virtual ~BooksReadEventHandler() = default;
-
-		BooksReadEventHandler& operator=(const BooksReadEventHandler&) = delete;
-		BooksReadEventHandler& operator=(BooksReadEventHandler&&) = delete;
-	};
-
-
-	class CriticalHitEventHandler : public RE::BSTEventSink<RE::CriticalHit::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static CriticalHitEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::CriticalHit::Event* a_event, RE::BSTEventSource<RE::CriticalHit::Event>* a_dispatcher) override;
-
-	private:
-		CriticalHitEventHandler() = default;
-		CriticalHitEventHandler(const CriticalHitEventHandler&) = delete;
-		CriticalHitEventHandler(CriticalHitEventHandler&&) = delete;
-		virtual ~CriticalHitEventHandler() = default;
-
-		CriticalHitEventHandler& operator=(const CriticalHitEventHandler&) = delete;
-		CriticalHitEventHandler& operator=(CriticalHitEventHandler&&) = delete;
-	};
-
-
-	class DisarmedEventHandler : public RE::BSTEventSink<RE::DisarmedEvent::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static DisarmedEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::DisarmedEvent::Event* a_event, RE::BSTEventSource<RE::DisarmedEvent::Event>* a_dispatcher) override;
-
-	private:
-		DisarmedEventHandler() = default;
-		DisarmedEventHandler(const DisarmedEventHandler&) = delete;
-		DisarmedEventHandler(DisarmedEventHandler&&) = delete;
-		virtual ~DisarmedEventHandler() = default;
-
-		DisarmedEventHandler& operator=(const DisarmedEventHandler&) = delete;
-		DisarmedEventHandler& operator=(DisarmedEventHandler&&) = delete;
-	};
-
-
-	class DragonSoulsGainedEventHandler : public RE::BSTEventSink<RE::DragonSoulsGained::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static DragonSoulsGainedEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::DragonSoulsGained::Event* a_event, RE::BSTEventSource<RE::DragonSoulsGained::Event>* a_dispatcher) override;
-
-	private:
-		DragonSoulsGainedEventHandler() = default;
-		DragonSoulsGainedEventHandler(const DragonSoulsGainedEventHandler&) = delete;
-		DragonSoulsGainedEventHandler(DragonSoulsGainedEventHandler&&) = delete;
-		virtual ~DragonSoulsGainedEventHandler() = default;
-
-		DragonSoulsGainedEventHandler& operator=(const DragonSoulsGainedEventHandler&) = delete;
-		DragonSoulsGainedEventHandler& operator=(DragonSoulsGainedEventHandler&&) = delete;
-	};
-
-
-	class ItemHarvestedEventHandler : public RE::BSTEventSink<RE::TESHarvestedEvent::ItemHarvested>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static ItemHarvestedEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::TESHarvestedEvent::ItemHarvested* a_event, RE::BSTEventSource<RE::TESHarvestedEvent::ItemHarvested>* a_dispatcher) override;
-
-	private:
-		ItemHarvestedEventHandler() = default;
-		ItemHarvestedEventHandler(const ItemHarvestedEventHandler&) = delete;
-		ItemHarvestedEventHandler(ItemHarvestedEventHandler&&) = delete;
-		virtual ~ItemHarvestedEventHandler() = default;
-
-		ItemHarvestedEventHandler& operator=(const ItemHarvestedEventHandler&) = delete;
-		ItemHarvestedEventHandler& operator=(ItemHarvestedEventHandler&&) = delete;
-	};
-
-
-	class LevelIncreaseEventHandler : public RE::BSTEventSink<RE::LevelIncrease::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static LevelIncreaseEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::LevelIncrease::Event* a_event, RE::BSTEventSource<RE::LevelIncrease::Event>* a_dispatcher) override;
-
-	private:
-		LevelIncreaseEventHandler() = default;
-		LevelIncreaseEventHandler(const LevelIncreaseEventHandler&) = delete;
-		LevelIncreaseEventHandler(LevelIncreaseEventHandler&&) = delete;
-		virtual ~LevelIncreaseEventHandler() = default;
-
-		LevelIncreaseEventHandler& operator=(const LevelIncreaseEventHandler&) = delete;
-		LevelIncreaseEventHandler& operator=(LevelIncreaseEventHandler&&) = delete;
-	};
-
-
-	class LocationDiscoveryEventHandler : public RE::BSTEventSink<RE::LocationDiscovery::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static LocationDiscoveryEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::LocationDiscovery::Event* a_event, RE::BSTEventSource<RE::LocationDiscovery::Event>* a_dispatcher) override;
-
-	private:
-		LocationDiscoveryEventHandler() = default;
-		LocationDiscoveryEventHandler(const LocationDiscoveryEventHandler&) = delete;
-		LocationDiscoveryEventHandler(LocationDiscoveryEventHandler&&) = delete;
-		virtual ~LocationDiscoveryEventHandler() = default;
-
-		LocationDiscoveryEventHandler& operator=(const LocationDiscoveryEventHandler&) = delete;
-		LocationDiscoveryEventHandler& operator=(LocationDiscoveryEventHandler&&) = delete;
-	};
-
-
-	class ShoutAttackEventHandler : public RE::BSTEventSink<RE::ShoutAttack::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static ShoutAttackEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::ShoutAttack::Event* a_event, RE::BSTEventSource<RE::ShoutAttack::Event>* a_dispatcher) override;
-
-	private:
-		ShoutAttackEventHandler() = default;
-		ShoutAttackEventHandler(const ShoutAttackEventHandler&) = delete;
-		ShoutAttackEventHandler(ShoutAttackEventHandler&&) = delete;
-		virtual ~ShoutAttackEventHandler() = default;
-
-		ShoutAttackEventHandler& operator=(const ShoutAttackEventHandler&) = delete;
-		ShoutAttackEventHandler& operator=(ShoutAttackEventHandler&&) = delete;
-	};
-
-
-	class SkillIncreaseEventHandler : public RE::BSTEventSink<RE::SkillIncrease::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static SkillIncreaseEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::SkillIncrease::Event* a_event, RE::BSTEventSource<RE::SkillIncrease::Event>* a_dispatcher) override;
-
-	private:
-		SkillIncreaseEventHandler() = default;
-		SkillIncreaseEventHandler(const SkillIncreaseEventHandler&) = delete;
-		SkillIncreaseEventHandler(SkillIncreaseEventHandler&&) = delete;
-		virtual ~SkillIncreaseEventHandler() = default;
-
-		SkillIncreaseEventHandler& operator=(const SkillIncreaseEventHandler&) = delete;
-		SkillIncreaseEventHandler& operator=(SkillIncreaseEventHandler&&) = delete;
-	};
-
-
-	class SoulsTrappedEventHandler : public RE::BSTEventSink<RE::SoulsTrapped::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static SoulsTrappedEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::SoulsTrapped::Event* a_event, RE::BSTEventSource<RE::SoulsTrapped::Event>* a_dispatcher) override;
-
-	private:
-		SoulsTrappedEventHandler() = default;
-		SoulsTrappedEventHandler(const SoulsTrappedEventHandler&) = delete;
-		SoulsTrappedEventHandler(SoulsTrappedEventHandler&&) = delete;
-		virtual ~SoulsTrappedEventHandler() = default;
-
-		SoulsTrappedEventHandler& operator=(const SoulsTrappedEventHandler&) = delete;
-		SoulsTrappedEventHandler& operator=(SoulsTrappedEventHandler&&) = delete;
-	};
-
-
-	class SpellsLearnedEventHandler : public RE::BSTEventSink<RE::SpellsLearned::Event>
-	{
-	public:
-		using EventResult = RE::BSEventNotifyControl;
-
-		static SpellsLearnedEventHandler* GetSingleton();
-
-		virtual EventResult ProcessEvent(const RE::SpellsLearned::Event* a_event, RE::BSTEventSource<RE::SpellsLearned::Event>* a_dispatcher) override;
+	using ActorKillEventHandler = EventSinks::EventHandler<RE::ActorKill::Event, EventSinks::EVENT::kActorKill>;
+	using BooksReadEventHandler = EventSinks::EventHandler<RE::BooksRead::Event, EventSinks::EVENT::kBookRead>;
+	using CriticalHitEventHandler = EventSinks::EventHandler<RE::CriticalHit::Event, EventSinks::EVENT::kCritHit>;
+	using DisarmedEventHandler = EventSinks::EventHandler<RE::DisarmedEvent::Event, EventSinks::EVENT::kDisarm>;
+	using DragonSoulsGainedEventHandler = EventSinks::EventHandler<RE::DragonSoulsGained::Event, EventSinks::EVENT::kDragonSoul>;
+	using ItemHarvestedEventHandler = EventSinks::EventHandler<RE::TESHarvestedEvent::ItemHarvested, EventSinks::EVENT::kHarvest>;
+	using LevelIncreaseEventHandler = EventSinks::EventHandler<RE::LevelIncrease::Event, EventSinks::EVENT::kLevelIncrease>;
+	using LocationDiscoveryEventHandler = EventSinks::EventHandler<RE::LocationDiscovery::Event, EventSinks::EVENT::kLocDiscovery>;
+	using ShoutAttackEventHandler = EventSinks::EventHandler<RE::ShoutAttack::Event, EventSinks::EVENT::kShoutAttack>;
+	using SkillIncreaseEventHandler = EventSinks::EventHandler<RE::SkillIncrease::Event, EventSinks::EVENT::kSkillIncrease, EventSinks::EVENT::kSkillIncreaseEx>;
+	using SoulsTrappedEventHandler = EventSinks::EventHandler<RE::SoulsTrapped::Event, EventSinks::EVENT::kSoulTrap>;
+	using SpellsLearnedEventHandler = EventSinks::EventHandler<RE::SpellsLearned::Event, EventSinks::EVENT::kSpellLearned>;
+}
 
-	private:
-		SpellsLearnedEventHandler() = default;
-		SpellsLearnedEventHandler(const SpellsLearnedEventHandler&) = delete;
-		SpellsLearnedEventHandler(SpellsLearnedEventHandler&&) = delete;
-		virtual ~SpellsLearnedEventHandler() = default;
 
-		SpellsLearnedEventHandler& operator=(const SpellsLearnedEventHandler&) = delete;
-		SpellsLearnedEventHandler& operator=(SpellsLearnedEventHandler&&) = delete;
-	};
-}
\ No newline at end of file
+namespace EventSinks
+{
+	template <>
+	void ScriptEvents::CellFullyLoadedEventHandler::Dispatch(const RE::TESCellFullyLoadedEvent& a_event);
+	template <>
+	void ScriptEvents::QuestStartStopEventHandler::Dispatch(const RE::TESQuestStartStopEvent& a_event);
+	template <>
+	void ScriptEvents::QuestStageEventHandler::Dispatch(const RE::TESQuestStageEvent& a_event);
+	template <>
+	void ScriptEvents::ObjectLoadedEventHandler::Dispatch(const RE::TESObjectLoadedEvent& a_event);
+	template <>
+	void ScriptEvents::GrabReleaseEventHandler::Dispatch(const RE::TESGrabReleaseEvent& a_event);
+
+	template <>
+	void StoryEvents::ActorKillEventHandler::Dispatch(const RE::ActorKill::Event& a_event);
+	template <>
+	void StoryEvents::BooksReadEventHandler::Dispatch(const RE::BooksRead::Event& a_event);
+	template <>
+	void StoryEvents::CriticalHitEventHandler::Dispatch(const RE::CriticalHit::Event& a_event);
+	template <>
+	void StoryEvents::DisarmedEventHandler::Dispatch(const RE::DisarmedEvent::Event& a_event);
+	template <>
+	void StoryEvents::DragonSoulsGainedEventHandler::Dispatch(const RE::DragonSoulsGained::Event& a_event);
+	template <>
+	void StoryEvents::ItemHarvestedEventHandler::Dispatch(const RE::TESHarvestedEvent::ItemHarvested& a_event);
+	template <>
+	void StoryEvents::LevelIncreaseEventHandler::Dispatch(const RE::LevelIncrease::Event& a_event);
+	template <>
+	void StoryEvents::LocationDiscoveryEventHandler::Dispatch(const RE::LocationDiscovery::Event& a_event);
+	template <>
+	void StoryEvents::ShoutAttackEventHandler::Dispatch(const RE::ShoutAttack::Event& a_event);
+	template <>
+	void StoryEvents::SkillIncreaseEventHandler::Dispatch(const RE::SkillIncrease::Event& a_event);
+	template <>
+	void StoryEvents::SoulsTrappedEventHandler::Dispatch(const RE::SoulsTrapped::Event& a_event);
+	template <>
+	void StoryEvents::SpellsLearnedEventHandler::Dispatch(const RE::SpellsLearned::Event& a_event);
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Util/FormIndex.h"
+
+#include <execution>
 
 namespace papyrusGame
 {
@@ -8,37 +11,103 @@ namespace papyrusGame
 	using Severity = RE::BSScript::ErrorLogger::Severity;
 
 
+	// arrays below this are filtered serially, as splitting them costs more than the scan
+	inline constexpr std::size_t PARALLEL_SCAN_THRESHOLD = 8192;
+	inline constexpr std::size_t PARALLEL_SCAN_CHUNK = 2048;
+
+
+	// appends the non-null forms passing the filter, in array order
+	// large arrays are split into chunks filtered on the parallel pool, so the filter must only read
+	template <class T, class F>
+	void ScanForms(const RE::BSTArray<T*>& a_forms, std::vector<T*>& a_vec, F&& a_filter)
+	{
+		const std::size_t size = a_forms.size();
+		if (size < PARALLEL_SCAN_THRESHOLD) {
+			for (const auto& form : a_forms) {
+				if (form && a_filter(form)) {
+					a_vec.push_back(form);
+				}
+			}
+			return;
+		}
+
+		std::vector<std::vector<T*>> chunks((size + PARALLEL_SCAN_CHUNK - 1) / PARALLEL_SCAN_CHUNK);
+		std::for_each(std::execution::par, chunks.begin(), chunks.end(), [&](std::vector<T*>& a_chunk) {
+			const auto begin = static_cast<std::size_t>(&a_chunk - chunks.data()) * PARALLEL_SCAN_CHUNK;
+			const auto end = std::min(begin + PARALLEL_SCAN_CHUNK, size);
+			for (auto i = begin; i < end; i++) {
+				if (const auto form = a_forms[static_cast<std::uint32_t>(i)]; form && a_filter(form)) {
+					a_chunk.push_back(form);
+				}
+			}
+		});
+
+		std::size_t total = 0;
+		for (const auto& chunk : chunks) {
+			total += chunk.size();
+		}
+		a_vec.reserve(a_vec.size() + total);
+		for (const auto& chunk : chunks) {
+			a_vec.insert(a_vec.end(), chunk.begin(), chunk.end());
+		}
+	}
+
+
 	template <class T>
 	void GetAllForms(std::vector<T*>& a_vec, const std::vector<RE::BGSKeyword*>& a_keywords)
 	{
-		if (auto dataHandler = RE::TESDataHandler::GetSingleton(); dataHandler) {
-			for (const auto& form : dataHandler->GetFormArray<T>()) {
-				if (!form || !a_keywords.empty() && !form->HasKeywords(a_keywords)) {
-					continue;
-				}
-				a_vec.push_back(form);
+		if (!a_keywords.empty()) {
+			if (const auto forms = FormIndex::Keywords::GetSingleton()->GetForms<T>(a_keywords); forms) {
+				a_vec.insert(a_vec.end(), forms->begin(), forms->end());
+				return;
 			}
 		}
+
+		if (auto dataHandler = RE::TESDataHandler::GetSingleton(); dataHandler) {
+			ScanForms(dataHandler->GetFormArray<T>(), a_vec, [&](T* a_form) {
+				return a_keywords.empty() || a_form->HasKeywords(a_keywords);
+			});
+		}
 	}
 	
 	template <class T>
 	void GetAllFormsInMod(const RE::TESFile* a_modInfo, std::vector<T*>& a_vec, const std::vector<RE::BGSKeyword*>& a_keywords)
 	{
-		if (auto dataHandler = RE::TESDataHandler::GetSingleton(); dataHandler) {
-			for (const auto& form : dataHandler->GetFormArray<T>()) {
-				if (!form || !a_modInfo->IsFormInMod(form->formID) || !a_keywords.empty() && !form->HasKeywords(a_keywords)) {
-					continue;
+		if (const auto forms = FormIndex::Plugins::GetSingleton()->GetForms<T>(a_modInfo); forms) {
+			for (const auto& form : *forms) {
+				if (a_keywords.empty() || form->HasKeywords(a_keywords)) {
+					a_vec.push_back(form);
 				}
-				a_vec.push_back(form);
 			}
+			return;
+		}
+
+		if (auto dataHandler = RE::TESDataHandler::GetSingleton(); dataHandler) {
+			ScanForms(dataHandler->GetFormArray<T>(), a_vec, [&](T* a_form) {
+				return a_modInfo->IsFormInMod(a_form->formID) && (a_keywords.empty() || a_form->HasKeywords(a_keywords));
+			});
 		}
 	}
 
 
+	// GetAllFormsOfType filters, all applied to each candidate in a single pass
+	struct FormFilter
+	{
+		std::vector<RE::BGSKeyword*> any;
+		std::vector<RE::BGSKeyword*> all;
+		const RE::TESFile* modInfo{ nullptr };
+		bool playable{ false };
+	};
+
+	void QueryForms(RE::FormType a_formType, const FormFilter& a_filter, std::vector<RE::TESForm*>& a_vec);
+
+
 	std::vector<RE::Actor*> GetActorsByProcessingLevel(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, std::int32_t a_level);
 
 	std::vector<RE::EnchantmentItem*> GetAllEnchantments(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, std::vector<RE::BGSKeyword*> a_keywords);
 
+	std::vector<RE::TESForm*> GetAllFormsOfType(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, std::uint32_t a_formType, std::vector<RE::BGSKeyword*> a_any, std::vector<RE::BGSKeyword*> a_all, RE::BSFixedString a_plugin, bool a_playable);
+
 	std::vector<RE::TESRace*> GetAllRaces(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, std::vector<RE::BGSKeyword*> a_keywords);
 
 	std::vector<RE::SpellItem*> GetAllSpells(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, std::vector<RE::BGSKeyword*> a_keywords, bool a_playable);
@@ -57,6 +126,12 @@ namespace papyrusGame
 
 	std::int32_t GetNumActorsInHigh(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*);
 
+	std::vector<std::string> GetPapyrusExtenderCoSaveStats(VM*, StackID, RE::StaticFunctionTag*);
+
+	std::vector<std::string> GetPapyrusExtenderConditionStats(VM*, StackID, RE::StaticFunctionTag*);
+
+	std::vector<std::string> GetPapyrusExtenderMemoryStats(VM*, StackID, RE::StaticFunctionTag*);
+
 	std::vector<std::int32_t> GetPapyrusExtenderVersion(VM*, StackID, RE::StaticFunctionTag*);
 
 	bool IsPluginFound(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::BSFixedString a_name);
@@ -65,6 +140,8 @@ namespace papyrusGame
 
 	void SetLocalGravity(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, float a_x, float a_y, float a_z);
 
+	void SetPapyrusExtenderConditionProfiling(VM*, StackID, RE::StaticFunctionTag*, bool a_enable);
+
 
 	bool RegisterFuncs(VM* a_vm);
 }
\ No newline at end of file
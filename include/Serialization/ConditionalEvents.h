@@ -0,0 +1,303 @@
+#pragma once
+
+#include "Serialization/Events.h"
+#include "Util/ConditionCache.h"
+#include "Util/ConditionEvaluator.h"
+
+
+namespace Serialization
+{
+	// events that can be registered for with a condition list : subject, target
+	inline constexpr std::array CONDITIONAL_EVENTS{
+		EVENT::kActorKill,        // victim, killer
+		EVENT::kSoulTrap,         // victim, trapper
+		EVENT::kMagicEffectApply  // effect target, caster
+	};
+
+
+	constexpr bool HasConditions(EVENT a_event)
+	{
+		for (const auto event : CONDITIONAL_EVENTS) {
+			if (event == a_event) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+	// registrations that only receive the event if their condition list passes for its subject and target
+	// registrations with the same list share a group, so each list is evaluated once per event
+	template <EVENT E>
+	class ConditionalRegistration
+	{
+		static_assert(HasConditions(E), "event has no condition subject");
+
+	public:
+		using Base = typename EventTraits<E>::type;
+		using ConditionList = std::vector<std::string>;
+
+
+		static ConditionalRegistration* GetSingleton()
+		{
+			static ConditionalRegistration singleton;
+			return &singleton;
+		}
+
+
+		static constexpr EVENT GetEvent() { return E; }
+
+
+		// fails if none of the conditions could be parsed
+		template <class Obj, class... Args>
+		bool Register(Obj* a_object, const std::vector<RE::BSFixedString>& a_conditionList, Args&&... a_args)
+		{
+			const auto chain = Condition::Cache::GetSingleton()->GetOrderedChain(a_conditionList);
+			if (!chain) {
+				return false;
+			}
+
+			ConditionList conditions;
+			conditions.reserve(a_conditionList.size());
+			for (const auto& condition : a_conditionList) {
+				conditions.emplace_back(condition.c_str(), condition.size());
+			}
+
+			Locker locker(_lock);
+			auto& group = _groups[std::move(conditions)];
+			if (!group.regs) {
+				group.chain = chain;
+				group.regs = std::make_shared<Group>();
+			}
+			group.regs->Register(a_object, std::forward<Args>(a_args)...);
+
+			return true;
+		}
+
+
+		// removes the object from every condition list
+		template <class Obj, class... Args>
+		void Unregister(Obj* a_object, const Args&... a_args)
+		{
+			Locker locker(_lock);
+			for (auto it = _groups.begin(); it != _groups.end();) {
+				it->second.regs->Unregister(a_object, a_args...);
+				it = it->second.regs->Empty() ? _groups.erase(it) : std::next(it);
+			}
+		}
+
+
+		template <class Obj>
+		void UnregisterAll(Obj* a_object)
+		{
+			Locker locker(_lock);
+			for (auto it = _groups.begin(); it != _groups.end();) {
+				it->second.regs->UnregisterAll(a_object);
+				it = it->second.regs->Empty() ? _groups.erase(it) : std::next(it);
+			}
+		}
+
+
+		// drops the object from this event regardless of filters, if it can register for it at all
+		template <class Obj>
+		void UnregisterObject(Obj* a_object)
+		{
+			if constexpr (detail::has_unregister_all<Base, Obj>::value) {
+				UnregisterAll(a_object);
+			} else if constexpr (detail::has_unregister<Base, Obj>::value) {
+				Unregister(a_object);
+			}
+		}
+
+
+		// conditions are evaluated here, on the thread that raised the event, and only passing groups queue it
+		template <class... Args>
+		void QueueEvent(const RE::TESObjectREFR* a_subject, const RE::TESObjectREFR* a_target, Args... a_args)
+		{
+			constexpr auto size = sizeof(std::tuple<Args...>);
+
+			const auto subject = const_cast<RE::TESObjectREFR*>(a_subject);
+			const auto target = const_cast<RE::TESObjectREFR*>(a_target);
+
+			//evaluated unlocked, so registering scripts don't wait on the conditions
+			std::vector<Entry> groups;
+			{
+				Locker locker(_lock);
+				groups.reserve(_groups.size());
+				for (const auto& [conditions, group] : _groups) {
+					groups.push_back(group);
+				}
+			}
+
+			for (const auto& group : groups) {
+				if (!Condition::IsTrue(group.chain.get(), subject, target)) {
+					continue;
+				}
+
+				MemoryStats::Alloc(MemoryStats::TYPE::kQueuedEvents, size);
+				SKSE::GetTaskInterface()->AddTask([regs = group.regs, a_args...]() {
+					regs->SendEvent(a_args...);
+					MemoryStats::Free(MemoryStats::TYPE::kQueuedEvents, size);
+				});
+			}
+		}
+
+
+		bool Empty() const
+		{
+			Locker locker(_lock);
+			return _groups.empty();
+		}
+
+
+		std::size_t GetNumGroups() const
+		{
+			Locker locker(_lock);
+			return _groups.size();
+		}
+
+
+		void Clear()
+		{
+			Locker locker(_lock);
+			_groups.clear();
+		}
+
+
+		// the condition strings are saved rather than the chain, so forms resolve by plugin name on load
+		bool Save(SKSE::SerializationInterface* a_intfc) const
+		{
+			Locker locker(_lock);
+
+			a_intfc->WriteRecordData(static_cast<std::uint32_t>(_groups.size()));
+			for (const auto& [conditions, group] : _groups) {
+				a_intfc->WriteRecordData(static_cast<std::uint32_t>(conditions.size()));
+				for (const auto& condition : conditions) {
+					const auto length = static_cast<std::uint32_t>(condition.size());
+					a_intfc->WriteRecordData(length);
+					a_intfc->WriteRecordData(condition.data(), length);
+				}
+				if (!group.regs->Save(a_intfc)) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+
+		bool Load(SKSE::SerializationInterface* a_intfc)
+		{
+			std::uint32_t numGroups;
+			a_intfc->ReadRecordData(numGroups);
+
+			Locker locker(_lock);
+			_groups.clear();
+
+			for (std::uint32_t i = 0; i < numGroups; i++) {
+				std::uint32_t numConditions;
+				a_intfc->ReadRecordData(numConditions);
+
+				ConditionList conditions(numConditions);
+				std::vector<RE::BSFixedString> conditionList;
+				conditionList.reserve(numConditions);
+				for (auto& condition : conditions) {
+					std::uint32_t length;
+					a_intfc->ReadRecordData(length);
+					condition.resize(length);
+					a_intfc->ReadRecordData(condition.data(), length);
+					conditionList.emplace_back(condition.c_str());
+				}
+
+				auto regs = std::make_shared<Group>();
+				if (!regs->Load(a_intfc)) {
+					return false;
+				}
+
+				const auto chain = Condition::Cache::GetSingleton()->GetOrderedChain(conditionList);
+				if (!chain) {
+					logger::warn("{} : dropped registrations, condition list no longer parses"sv, EVENTS[to_underlying(E)].name);
+					continue;
+				}
+
+				_groups.insert_or_assign(std::move(conditions), Entry{ chain, std::move(regs) });
+			}
+
+			return true;
+		}
+
+	private:
+		using Lock = std::mutex;
+		using Locker = std::lock_guard<Lock>;
+
+
+		class Group : public Base
+		{
+		public:
+			Group() :
+				Base(EVENTS[to_underlying(E)].name)
+			{}
+
+
+			bool Empty() const
+			{
+				std::lock_guard locker(this->_lock);
+				if constexpr (std::is_base_of_v<SKSE::Impl::RegistrationSetBase, Base>) {
+					return this->_handles.empty();
+				} else {
+					return this->_regs.empty();
+				}
+			}
+		};
+
+
+		struct Entry
+		{
+			Condition::Cache::Chain chain;
+			std::shared_ptr<Group> regs;
+		};
+
+
+		ConditionalRegistration() = default;
+		ConditionalRegistration(const ConditionalRegistration&) = delete;
+		ConditionalRegistration(ConditionalRegistration&&) = delete;
+		~ConditionalRegistration() = default;
+
+		ConditionalRegistration& operator=(const ConditionalRegistration&) = delete;
+		ConditionalRegistration& operator=(ConditionalRegistration&&) = delete;
+
+		std::map<ConditionList, Entry> _groups;
+		mutable Lock _lock;
+	};
+
+
+	namespace ConditionalEvents
+	{
+		using OnActorKillRegSet = ConditionalRegistration<EVENT::kActorKill>;
+		using OnSoulsTrappedRegSet = ConditionalRegistration<EVENT::kSoulTrap>;
+		using OnMagicEffectApplyRegMap = ConditionalRegistration<EVENT::kMagicEffectApply>;
+	}
+
+
+	template <class F, std::size_t... I>
+	void ForEachConditionalRegistration(F&& a_func, std::index_sequence<I...>)
+	{
+		(a_func(ConditionalRegistration<CONDITIONAL_EVENTS[I]>::GetSingleton()), ...);
+	}
+
+
+	template <class F>
+	void ForEachConditionalRegistration(F&& a_func)
+	{
+		ForEachConditionalRegistration(std::forward<F>(a_func), std::make_index_sequence<CONDITIONAL_EVENTS.size()>{});
+	}
+
+
+	template <class Obj>
+	void UnregisterForAllConditionalEvents(Obj* a_object)
+	{
+		ForEachConditionalRegistration([&](auto* a_regs) {
+			a_regs->UnregisterObject(a_object);
+		});
+	}
+}
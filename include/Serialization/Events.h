@@ -1,567 +1,571 @@
 #pragma once
 
+#include "Serialization/HandleIndex.h"
+#include "Serialization/Manager.h"
+#include "Util/MemoryStats.h"
+
 
 namespace Serialization
 {
-	namespace ScriptEvents
+	enum class EVENT : std::uint32_t
 	{
-		class OnCellFullyLoadedRegSet : public SKSE::RegistrationSet<const RE::TESObjectCELL*>
-		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::TESObjectCELL*>;
-
-
-			static OnCellFullyLoadedRegSet* GetSingleton();
-
-		private:
-			OnCellFullyLoadedRegSet();
-			OnCellFullyLoadedRegSet(const OnCellFullyLoadedRegSet&) = delete;
-			OnCellFullyLoadedRegSet(OnCellFullyLoadedRegSet&&) = delete;
-			~OnCellFullyLoadedRegSet() = default;
-
-			OnCellFullyLoadedRegSet& operator=(const OnCellFullyLoadedRegSet&) = delete;
-			OnCellFullyLoadedRegSet& operator=(OnCellFullyLoadedRegSet&&) = delete;
-		};
-
-
-		class OnQuestStartRegMap : public SKSE::RegistrationMap<const RE::TESQuest*>
-		{
-		public:
-			using Base = SKSE::RegistrationMap<const RE::TESQuest*>;
-
-
-			static OnQuestStartRegMap* GetSingleton();
+		kCellFullyLoaded,
+		kQuestStart,
+		kQuestStop,
+		kQuestStage,
+		kObjectLoaded,
+		kObjectUnloaded,
+		kGrab,
+		kRelease,
+
+		kActorKill,
+		kBookRead,
+		kCritHit,
+		kDisarm,
+		kDragonSoul,
+		kHarvest,
+		kLevelIncrease,
+		kLocDiscovery,
+		kShoutAttack,
+		kSkillIncrease,
+		kSkillIncreaseEx,
+		kSoulTrap,
+		kSpellLearned,
+
+		kActorResurrect,
+		kActorReanimateStart,
+		kActorReanimateStop,
+		kWeatherChange,
+		kMagicEffectApply,
+		kWeaponHit,
+		kMagicHit,
+		kProjectileHit,
+
+		kFECReset,
+
+		kTotal
+	};
+	static_assert(to_underlying(EVENT::kTotal) <= HandleIndex::MAX_EVENTS);
+
+
+	struct EventDescriptor
+	{
+		EVENT event;
+		std::string_view name;     // papyrus event
+		std::uint32_t record;      // co-save type code
+		std::string_view binding;  // RegisterFor/UnregisterFor suffix, empty if the natives are hand-written
+	};
+
+
+	inline constexpr std::array<EventDescriptor, to_underlying(EVENT::kTotal)> EVENTS{ {
+		{ EVENT::kCellFullyLoaded, "OnCellFullyLoaded"sv, kOnCellFullyLoaded, "CellFullyLoaded"sv },
+		{ EVENT::kQuestStart, "OnQuestStart"sv, kQuestStart, ""sv },
+		{ EVENT::kQuestStop, "OnQuestStop"sv, kQuestStop, ""sv },
+		{ EVENT::kQuestStage, "OnQuestStageChange"sv, kQuestStage, ""sv },
+		{ EVENT::kObjectLoaded, "OnObjectLoaded"sv, kObjectLoaded, ""sv },
+		{ EVENT::kObjectUnloaded, "OnObjectUnloaded"sv, kObjectUnloaded, ""sv },
+		{ EVENT::kGrab, "OnObjectGrab"sv, kGrab, ""sv },
+		{ EVENT::kRelease, "OnObjectRelease"sv, kRelease, ""sv },
+
+		{ EVENT::kActorKill, "OnActorKilled"sv, kActorKill, "ActorKilled"sv },
+		{ EVENT::kBookRead, "OnBookRead"sv, kBookRead, "BookRead"sv },
+		{ EVENT::kCritHit, "OnCriticalHit"sv, kCritHit, "CriticalHit"sv },
+		{ EVENT::kDisarm, "OnDisarmed"sv, kDisarm, "Disarmed"sv },
+		{ EVENT::kDragonSoul, "OnDragonSoulsGained"sv, kDragonSoul, "DragonSoulGained"sv },
+		{ EVENT::kHarvest, "OnItemHarvested"sv, kHarvest, "ItemHarvested"sv },
+		{ EVENT::kLevelIncrease, "OnLevelIncrease"sv, kLevelIncrease, "LevelIncrease"sv },
+		{ EVENT::kLocDiscovery, "OnLocationDiscovery"sv, kLocDiscovery, "LocationDiscovery"sv },
+		{ EVENT::kShoutAttack, "OnPlayerShoutAttack"sv, kShoutAttack, "ShoutAttack"sv },
+		{ EVENT::kSkillIncrease, "OnSkillIncrease"sv, kSkillIncrease, "SkillIncrease"sv },
+		{ EVENT::kSkillIncreaseEx, "OnSkillIncreaseEx"sv, kSkillIncreaseEx, "SkillIncreaseEx"sv },
+		{ EVENT::kSoulTrap, "OnSoulTrapped"sv, kSoulTrap, "SoulTrapped"sv },
+		{ EVENT::kSpellLearned, "OnSpellLearned"sv, kSpellLearned, "SpellLearned"sv },
+
+		{ EVENT::kActorResurrect, "OnActorResurrected"sv, kActorResurrect, "ActorResurrected"sv },
+		{ EVENT::kActorReanimateStart, "OnActorReanimateStart"sv, kActorReanimateStart, "ActorReanimateStart"sv },
+		{ EVENT::kActorReanimateStop, "OnActorReanimateStop"sv, kActorReanimateStop, "ActorReanimateStop"sv },
+		{ EVENT::kWeatherChange, "OnWeatherChanged"sv, kWeatherChange, "WeatherChange"sv },
+		{ EVENT::kMagicEffectApply, "OnMagicEffectApplyEx"sv, kMagicEffectApply, ""sv },
+		{ EVENT::kWeaponHit, "OnWeaponHit"sv, kWeaponHit, "WeaponHit"sv },
+		{ EVENT::kMagicHit, "OnMagicHit"sv, kMagicHit, "MagicHit"sv },
+		{ EVENT::kProjectileHit, "OnProjectileHit"sv, kProjectileHit, "ProjectileHit"sv },
+
+		{ EVENT::kFECReset, "OnFECReset"sv, kFECReset, ""sv }
+	} };
+
+
+	constexpr bool IsEventTableSorted()
+	{
+		for (std::uint32_t i = 0; i < EVENTS.size(); i++) {
+			if (to_underlying(EVENTS[i].event) != i) {
+				return false;
+			}
+		}
+		return true;
+	}
+	static_assert(IsEventTableSorted(), "EVENTS must be in EVENT order");
 
-		private:
-			OnQuestStartRegMap();
-			OnQuestStartRegMap(const OnQuestStartRegMap&) = delete;
-			OnQuestStartRegMap(OnQuestStartRegMap&&) = delete;
-			~OnQuestStartRegMap() = default;
 
-			OnQuestStartRegMap& operator=(const OnQuestStartRegMap&) = delete;
-			OnQuestStartRegMap& operator=(OnQuestStartRegMap&&) = delete;
-		};
+	template <EVENT E>
+	struct EventTraits;
 
+	template <>
+	struct EventTraits<EVENT::kCellFullyLoaded>
+	{
+		using type = SKSE::RegistrationSet<const RE::TESObjectCELL*>;
+	};
 
-		class OnQuestStopRegMap : public SKSE::RegistrationMap<const RE::TESQuest*>
-		{
-		public:
-			using Base = SKSE::RegistrationMap<const RE::TESQuest*>;
+	template <>
+	struct EventTraits<EVENT::kQuestStart>
+	{
+		using type = SKSE::RegistrationMap<const RE::TESQuest*>;
+	};
 
+	template <>
+	struct EventTraits<EVENT::kQuestStop>
+	{
+		using type = SKSE::RegistrationMap<const RE::TESQuest*>;
+	};
 
-			static OnQuestStopRegMap* GetSingleton();
+	template <>
+	struct EventTraits<EVENT::kQuestStage>
+	{
+		using type = SKSE::RegistrationMap<const RE::TESQuest*, std::uint32_t>;
+	};
 
-		private:
-			OnQuestStopRegMap();
-			OnQuestStopRegMap(const OnQuestStopRegMap&) = delete;
-			OnQuestStopRegMap(OnQuestStopRegMap&&) = delete;
-			~OnQuestStopRegMap() = default;
+	template <>
+	struct EventTraits<EVENT::kObjectLoaded>
+	{
+		using type = SKSE::RegistrationMap<const RE::TESObjectREFR*, RE::FormType>;
+	};
 
-			OnQuestStopRegMap& operator=(const OnQuestStopRegMap&) = delete;
-			OnQuestStopRegMap& operator=(OnQuestStopRegMap&&) = delete;
-		};
+	template <>
+	struct EventTraits<EVENT::kObjectUnloaded>
+	{
+		using type = SKSE::RegistrationMap<const RE::TESObjectREFR*, RE::FormType>;
+	};
 
+	template <>
+	struct EventTraits<EVENT::kGrab>
+	{
+		using type = SKSE::RegistrationSet<const RE::TESObjectREFR*>;
+	};
 
-		class OnQuestStageRegMap : public SKSE::RegistrationMap<const RE::TESQuest*, std::uint32_t>
-		{
-		public:
-			using Base = SKSE::RegistrationMap<const RE::TESQuest*, std::uint32_t>;
+	template <>
+	struct EventTraits<EVENT::kRelease>
+	{
+		using type = SKSE::RegistrationSet<const RE::TESObjectREFR*>;
+	};
 
+	template <>
+	struct EventTraits<EVENT::kActorKill>
+	{
+		using type = SKSE::RegistrationSet<const RE::Actor*, const RE::Actor*>;
+	};
 
-			static OnQuestStageRegMap* GetSingleton();
+	template <>
+	struct EventTraits<EVENT::kBookRead>
+	{
+		using type = SKSE::RegistrationSet<const RE::TESObjectBOOK*>;
+	};
 
-		private:
-			OnQuestStageRegMap();
-			OnQuestStageRegMap(const OnQuestStageRegMap&) = delete;
-			OnQuestStageRegMap(OnQuestStageRegMap&&) = delete;
-			~OnQuestStageRegMap() = default;
+	template <>
+	struct EventTraits<EVENT::kCritHit>
+	{
+		using type = SKSE::RegistrationSet<const RE::Actor*, const RE::TESObjectWEAP*, bool>;
+	};
 
-			OnQuestStageRegMap& operator=(const OnQuestStageRegMap&) = delete;
-			OnQuestStageRegMap& operator=(OnQuestStageRegMap&&) = delete;
-		};
+	template <>
+	struct EventTraits<EVENT::kDisarm>
+	{
+		using type = SKSE::RegistrationSet<const RE::Actor*, const RE::Actor*>;
+	};
 
+	template <>
+	struct EventTraits<EVENT::kDragonSoul>
+	{
+		using type = SKSE::RegistrationSet<float>;
+	};
 
-		class OnObjectLoadedRegMap : public SKSE::RegistrationMap<const RE::TESObjectREFR*, RE::FormType>
-		{
-		public:
-			using Base = SKSE::RegistrationMap<const RE::TESObjectREFR*, RE::FormType>;
+	template <>
+	struct EventTraits<EVENT::kHarvest>
+	{
+		using type = SKSE::RegistrationSet<const RE::TESForm*>;
+	};
 
+	template <>
+	struct EventTraits<EVENT::kLevelIncrease>
+	{
+		using type = SKSE::RegistrationSet<std::uint32_t>;
+	};
 
-			static OnObjectLoadedRegMap* GetSingleton();
+	template <>
+	struct EventTraits<EVENT::kLocDiscovery>
+	{
+		using type = SKSE::RegistrationSet<RE::BSFixedString, RE::BSFixedString>;
+	};
 
-		private:
-			OnObjectLoadedRegMap();
-			OnObjectLoadedRegMap(const OnObjectLoadedRegMap&) = delete;
-			OnObjectLoadedRegMap(OnObjectLoadedRegMap&&) = delete;
-			~OnObjectLoadedRegMap() = default;
+	template <>
+	struct EventTraits<EVENT::kShoutAttack>
+	{
+		using type = SKSE::RegistrationSet<const RE::TESShout*>;
+	};
 
-			OnObjectLoadedRegMap& operator=(const OnObjectLoadedRegMap&) = delete;
-			OnObjectLoadedRegMap& operator=(OnObjectLoadedRegMap&&) = delete;
-		};
+	template <>
+	struct EventTraits<EVENT::kSkillIncrease>
+	{
+		using type = SKSE::RegistrationSet<RE::BSFixedString>;
+	};
 
+	// filtered by actor value, ANY_SKILL receives every skill
+	inline constexpr std::uint32_t ANY_SKILL = static_cast<std::uint32_t>(-1);
 
-		class OnObjectUnloadedRegMap : public SKSE::RegistrationMap<const RE::TESObjectREFR*, RE::FormType>
-		{
-		public:
-			using Base = SKSE::RegistrationMap<const RE::TESObjectREFR*, RE::FormType>;
+	template <>
+	struct EventTraits<EVENT::kSkillIncreaseEx>
+	{
+		using type = SKSE::RegistrationMap<std::uint32_t>;
+	};
 
+	template <>
+	struct EventTraits<EVENT::kSoulTrap>
+	{
+		using type = SKSE::RegistrationSet<const RE::Actor*, const RE::Actor*>;
+	};
 
-			static OnObjectUnloadedRegMap* GetSingleton();
+	template <>
+	struct EventTraits<EVENT::kSpellLearned>
+	{
+		using type = SKSE::RegistrationSet<const RE::SpellItem*>;
+	};
 
-		private:
-			OnObjectUnloadedRegMap();
-			OnObjectUnloadedRegMap(const OnObjectUnloadedRegMap&) = delete;
-			OnObjectUnloadedRegMap(OnObjectUnloadedRegMap&&) = delete;
-			~OnObjectUnloadedRegMap() = default;
+	template <>
+	struct EventTraits<EVENT::kActorResurrect>
+	{
+		using type = SKSE::RegistrationSetUnique<const RE::Actor*, bool>;
+	};
 
-			OnObjectUnloadedRegMap& operator=(const OnObjectUnloadedRegMap&) = delete;
-			OnObjectUnloadedRegMap& operator=(OnObjectUnloadedRegMap&&) = delete;
-		};
+	template <>
+	struct EventTraits<EVENT::kActorReanimateStart>
+	{
+		using type = SKSE::RegistrationSetUnique<const RE::Actor*, const RE::Actor*>;
+	};
 
+	template <>
+	struct EventTraits<EVENT::kActorReanimateStop>
+	{
+		using type = SKSE::RegistrationSetUnique<const RE::Actor*, const RE::Actor*>;
+	};
 
-		class OnGrabRegSet : public SKSE::RegistrationSet<const RE::TESObjectREFR*>
-		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::TESObjectREFR*>;
+	template <>
+	struct EventTraits<EVENT::kWeatherChange>
+	{
+		using type = SKSE::RegistrationSet<const RE::TESWeather*, const RE::TESWeather*>;
+	};
 
+	template <>
+	struct EventTraits<EVENT::kMagicEffectApply>
+	{
+		using type = SKSE::RegistrationMapUnique<const RE::TESObjectREFR*, const RE::EffectSetting*, const RE::TESForm*, bool>;
+	};
 
-			static OnGrabRegSet* GetSingleton();
+	template <>
+	struct EventTraits<EVENT::kWeaponHit>
+	{
+		using type = SKSE::RegistrationSetUnique<const RE::TESObjectREFR*, const RE::TESForm*, const RE::BGSProjectile*, std::uint32_t>;
+	};
 
-		private:
-			OnGrabRegSet();
-			OnGrabRegSet(const OnGrabRegSet&) = delete;
-			OnGrabRegSet(OnGrabRegSet&&) = delete;
-			~OnGrabRegSet() = default;
+	template <>
+	struct EventTraits<EVENT::kMagicHit>
+	{
+		using type = SKSE::RegistrationSetUnique<const RE::TESObjectREFR*, const RE::TESForm*, const RE::BGSProjectile*>;
+	};
 
-			OnGrabRegSet& operator=(const OnGrabRegSet&) = delete;
-			OnGrabRegSet& operator=(OnGrabRegSet&&) = delete;
-		};
+	template <>
+	struct EventTraits<EVENT::kProjectileHit>
+	{
+		using type = SKSE::RegistrationSetUnique<const RE::TESObjectREFR*, const RE::TESForm*, const RE::BGSProjectile*>;
+	};
 
+	template <>
+	struct EventTraits<EVENT::kFECReset>
+	{
+		using type = SKSE::RegistrationMap<const RE::Actor*, std::uint32_t, bool>;
+	};
 
-		class OnReleaseRegSet : public SKSE::RegistrationSet<const RE::TESObjectREFR*>
-		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::TESObjectREFR*>;
 
+	namespace detail
+	{
+		template <class U, class Obj, class = void>
+		struct has_unregister : std::false_type
+		{};
 
-			static OnReleaseRegSet* GetSingleton();
+		template <class U, class Obj>
+		struct has_unregister<U, Obj, std::void_t<decltype(std::declval<U&>().Unregister(std::declval<Obj*>()))>> : std::true_type
+		{};
 
-		private:
-			OnReleaseRegSet();
-			OnReleaseRegSet(const OnReleaseRegSet&) = delete;
-			OnReleaseRegSet(OnReleaseRegSet&&) = delete;
-			~OnReleaseRegSet() = default;
+		template <class U, class Obj, class = void>
+		struct has_unregister_all : std::false_type
+		{};
 
-			OnReleaseRegSet& operator=(const OnReleaseRegSet&) = delete;
-			OnReleaseRegSet& operator=(OnReleaseRegSet&&) = delete;
-		};
+		template <class U, class Obj>
+		struct has_unregister_all<U, Obj, std::void_t<decltype(std::declval<U&>().UnregisterAll(std::declval<Obj*>()))>> : std::true_type
+		{};
 	}
 
 
-	namespace StoryEvents
+	template <EVENT E>
+	class Registration : public EventTraits<E>::type
 	{
-		class OnActorKillRegSet : public SKSE::RegistrationSet<const RE::Actor*, const RE::Actor*>
-		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::Actor*, const RE::Actor*>;
-
-
-			static OnActorKillRegSet* GetSingleton();
-
-		private:
-			OnActorKillRegSet();
-			OnActorKillRegSet(const OnActorKillRegSet&) = delete;
-			OnActorKillRegSet(OnActorKillRegSet&&) = delete;
-			~OnActorKillRegSet() = default;
-
-			OnActorKillRegSet& operator=(const OnActorKillRegSet&) = delete;
-			OnActorKillRegSet& operator=(OnActorKillRegSet&&) = delete;
-		};
-
-
-		class OnBooksReadRegSet : public SKSE::RegistrationSet<const RE::TESObjectBOOK*>
-		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::TESObjectBOOK*>;
-
-
-			static OnBooksReadRegSet* GetSingleton();
-
-		private:
-			OnBooksReadRegSet();
-			OnBooksReadRegSet(const OnBooksReadRegSet&) = delete;
-			OnBooksReadRegSet(OnBooksReadRegSet&&) = delete;
-			~OnBooksReadRegSet() = default;
-
-			OnBooksReadRegSet& operator=(const OnBooksReadRegSet&) = delete;
-			OnBooksReadRegSet& operator=(OnBooksReadRegSet&&) = delete;
-		};
-
-
-		class OnCriticalHitRegSet : public SKSE::RegistrationSet<const RE::Actor*, const RE::TESObjectWEAP*, bool>
-		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::Actor*, const RE::TESObjectWEAP*, bool>;
-
-
-			static OnCriticalHitRegSet* GetSingleton();
-
-		private:
-			OnCriticalHitRegSet();
-			OnCriticalHitRegSet(const OnCriticalHitRegSet&) = delete;
-			OnCriticalHitRegSet(OnCriticalHitRegSet&&) = delete;
-			~OnCriticalHitRegSet() = default;
-
-			OnCriticalHitRegSet& operator=(const OnCriticalHitRegSet&) = delete;
-			OnCriticalHitRegSet& operator=(OnCriticalHitRegSet&&) = delete;
-		};
-
-
-		class OnDisarmedRegSet : public SKSE::RegistrationSet<const RE::Actor*, const RE::Actor*>
-		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::Actor*, const RE::Actor*>;
+	public:
+		using Base = typename EventTraits<E>::type;
 
 
-			static OnDisarmedRegSet* GetSingleton();
-
-		private:
-			OnDisarmedRegSet();
-			OnDisarmedRegSet(const OnDisarmedRegSet&) = delete;
-			OnDisarmedRegSet(OnDisarmedRegSet&&) = delete;
-			~OnDisarmedRegSet() = default;
-
-			OnDisarmedRegSet& operator=(const OnDisarmedRegSet&) = delete;
-			OnDisarmedRegSet& operator=(OnDisarmedRegSet&&) = delete;
-		};
-
-
-		class OnDragonSoulsGainedRegSet : public SKSE::RegistrationSet<float>
+		static Registration* GetSingleton()
 		{
-		public:
-			using Base = SKSE::RegistrationSet<float>;
-
+			static Registration singleton;
+			return &singleton;
+		}
 
-			static OnDragonSoulsGainedRegSet* GetSingleton();
 
-		private:
-			OnDragonSoulsGainedRegSet();
-			OnDragonSoulsGainedRegSet(const OnDragonSoulsGainedRegSet&) = delete;
-			OnDragonSoulsGainedRegSet(OnDragonSoulsGainedRegSet&&) = delete;
-			~OnDragonSoulsGainedRegSet() = default;
+		static constexpr EVENT GetEvent() { return E; }
 
-			OnDragonSoulsGainedRegSet& operator=(const OnDragonSoulsGainedRegSet&) = delete;
-			OnDragonSoulsGainedRegSet& operator=(OnDragonSoulsGainedRegSet&&) = delete;
-		};
 
-
-		class OnItemHarvestedRegSet : public SKSE::RegistrationSet<const RE::TESForm*>
+		// the handle index is updated under the registration lock, by what the set itself reports as changed
+		template <class Obj, class... Args>
+		bool Register(Obj* a_object, Args&&... a_args)
 		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::TESForm*>;
-
-
-			static OnItemHarvestedRegSet* GetSingleton();
-
-		private:
-			OnItemHarvestedRegSet();
-			OnItemHarvestedRegSet(const OnItemHarvestedRegSet&) = delete;
-			OnItemHarvestedRegSet(OnItemHarvestedRegSet&&) = delete;
-			~OnItemHarvestedRegSet() = default;
-
-			OnItemHarvestedRegSet& operator=(const OnItemHarvestedRegSet&) = delete;
-			OnItemHarvestedRegSet& operator=(OnItemHarvestedRegSet&&) = delete;
-		};
+			std::lock_guard locker(this->_lock);
+			const bool result = Base::Register(a_object, std::forward<Args>(a_args)...);
+			if (result) {
+				HandleIndex::GetSingleton()->Add(HandleIndex::GetHandle(a_object), to_underlying(E));
+			}
+			return result;
+		}
 
 
-		class OnLevelIncreaseRegSet : public SKSE::RegistrationSet<std::uint32_t>
+		template <class Obj, class... Args>
+		bool Unregister(Obj* a_object, Args&&... a_args)
 		{
-		public:
-			using Base = SKSE::RegistrationSet<std::uint32_t>;
+			std::lock_guard locker(this->_lock);
+			const bool result = Base::Unregister(a_object, std::forward<Args>(a_args)...);
+			if (result) {
+				HandleIndex::GetSingleton()->Remove(HandleIndex::GetHandle(a_object), to_underlying(E));
+			}
+			return result;
+		}
 
 
-			static OnLevelIncreaseRegSet* GetSingleton();
-
-		private:
-			OnLevelIncreaseRegSet();
-			OnLevelIncreaseRegSet(const OnLevelIncreaseRegSet&) = delete;
-			OnLevelIncreaseRegSet(OnLevelIncreaseRegSet&&) = delete;
-			~OnLevelIncreaseRegSet() = default;
-
-			OnLevelIncreaseRegSet& operator=(const OnLevelIncreaseRegSet&) = delete;
-			OnLevelIncreaseRegSet& operator=(OnLevelIncreaseRegSet&&) = delete;
-		};
-
-
-		class OnLocationDiscoveryRegSet : public SKSE::RegistrationSet<RE::BSFixedString, RE::BSFixedString>
+		template <class Obj>
+		void UnregisterAll(Obj* a_object)
 		{
-		public:
-			using Base = SKSE::RegistrationSet<RE::BSFixedString, RE::BSFixedString>;
-
+			std::lock_guard locker(this->_lock);
+			Base::UnregisterAll(a_object);
+			HandleIndex::GetSingleton()->RemoveAll(HandleIndex::GetHandle(a_object), to_underlying(E));
+		}
 
-			static OnLocationDiscoveryRegSet* GetSingleton();
 
-		private:
-			OnLocationDiscoveryRegSet();
-			OnLocationDiscoveryRegSet(const OnLocationDiscoveryRegSet&) = delete;
-			OnLocationDiscoveryRegSet(OnLocationDiscoveryRegSet&&) = delete;
-			~OnLocationDiscoveryRegSet() = default;
-
-			OnLocationDiscoveryRegSet& operator=(const OnLocationDiscoveryRegSet&) = delete;
-			OnLocationDiscoveryRegSet& operator=(OnLocationDiscoveryRegSet&&) = delete;
-		};
-
-
-		class OnShoutAttackRegSet : public SKSE::RegistrationSet<const RE::TESShout*>
+		// drops the object from this event regardless of filters
+		template <class Obj>
+		void UnregisterObject(Obj* a_object)
 		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::TESShout*>;
-
+			if constexpr (detail::has_unregister_all<Base, Obj>::value) {
+				UnregisterAll(a_object);
+			} else {
+				Unregister(a_object);
+			}
+		}
 
-			static OnShoutAttackRegSet* GetSingleton();
 
-		private:
-			OnShoutAttackRegSet();
-			OnShoutAttackRegSet(const OnShoutAttackRegSet&) = delete;
-			OnShoutAttackRegSet(OnShoutAttackRegSet&&) = delete;
-			~OnShoutAttackRegSet() = default;
-
-			OnShoutAttackRegSet& operator=(const OnShoutAttackRegSet&) = delete;
-			OnShoutAttackRegSet& operator=(OnShoutAttackRegSet&&) = delete;
-		};
-
-
-		class OnSkillIncreaseRegSet : public SKSE::RegistrationSet<RE::BSFixedString>
+		template <class Obj>
+		static constexpr bool Accepts()
 		{
-		public:
-			using Base = SKSE::RegistrationSet<RE::BSFixedString>;
-
-
-			static OnSkillIncreaseRegSet* GetSingleton();
+			return detail::has_unregister_all<Base, Obj>::value || detail::has_unregister<Base, Obj>::value;
+		}
 
-		private:
-			OnSkillIncreaseRegSet();
-			OnSkillIncreaseRegSet(const OnSkillIncreaseRegSet&) = delete;
-			OnSkillIncreaseRegSet(OnSkillIncreaseRegSet&&) = delete;
-			~OnSkillIncreaseRegSet() = default;
 
-			OnSkillIncreaseRegSet& operator=(const OnSkillIncreaseRegSet&) = delete;
-			OnSkillIncreaseRegSet& operator=(OnSkillIncreaseRegSet&&) = delete;
-		};
-
-
-		class OnSoulsTrappedRegSet : public SKSE::RegistrationSet<const RE::Actor*, const RE::Actor*>
+		void Clear()
 		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::Actor*, const RE::Actor*>;
-
-
-			static OnSoulsTrappedRegSet* GetSingleton();
-
-		private:
-			OnSoulsTrappedRegSet();
-			OnSoulsTrappedRegSet(const OnSoulsTrappedRegSet&) = delete;
-			OnSoulsTrappedRegSet(OnSoulsTrappedRegSet&&) = delete;
-			~OnSoulsTrappedRegSet() = default;
+			std::lock_guard locker(this->_lock);
+			Base::Clear();
+			HandleIndex::GetSingleton()->Clear(to_underlying(E));
+		}
 
-			OnSoulsTrappedRegSet& operator=(const OnSoulsTrappedRegSet&) = delete;
-			OnSoulsTrappedRegSet& operator=(OnSoulsTrappedRegSet&&) = delete;
-		};
 
-
-		class OnSpellsLearnedRegSet : public SKSE::RegistrationSet<const RE::SpellItem*>
+		bool Load(SKSE::SerializationInterface* a_intfc)
 		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::SpellItem*>;
-
+			std::lock_guard locker(this->_lock);
+			const auto result = Base::Load(a_intfc);
 
-			static OnSpellsLearnedRegSet* GetSingleton();
+			const auto index = HandleIndex::GetSingleton();
+			index->Clear(to_underlying(E));
 
-		private:
-			OnSpellsLearnedRegSet();
-			OnSpellsLearnedRegSet(const OnSpellsLearnedRegSet&) = delete;
-			OnSpellsLearnedRegSet(OnSpellsLearnedRegSet&&) = delete;
-			~OnSpellsLearnedRegSet() = default;
+			ForEachHandle(GetRegistrations(), [&](RE::VMHandle a_handle) {
+				index->Add(a_handle, to_underlying(E));
+			});
 
-			OnSpellsLearnedRegSet& operator=(const OnSpellsLearnedRegSet&) = delete;
-			OnSpellsLearnedRegSet& operator=(OnSpellsLearnedRegSet&&) = delete;
-		};
-	}
+			return result;
+		}
 
 
-	namespace HookedEvents
-	{
-		class OnActorResurrectRegSet : public SKSE::RegistrationSetUnique<const RE::Actor*, bool>
+		template <class... Args>
+		void QueueEvent(Args... a_args)
 		{
-		public:
-			using Base = SKSE::RegistrationSetUnique<const RE::Actor*, bool>;
+			constexpr auto size = sizeof(std::tuple<Args...>);
 
+			MemoryStats::Alloc(MemoryStats::TYPE::kQueuedEvents, size);
+			SKSE::GetTaskInterface()->AddTask([this, a_args...]() {
+				this->SendEvent(a_args...);
+				MemoryStats::Free(MemoryStats::TYPE::kQueuedEvents, size);
+			});
+		}
 
-			static OnActorResurrectRegSet* GetSingleton();
 
-		private:
-			OnActorResurrectRegSet();
-			OnActorResurrectRegSet(const OnActorResurrectRegSet&) = delete;
-			OnActorResurrectRegSet(OnActorResurrectRegSet&&) = delete;
-			~OnActorResurrectRegSet() = default;
-
-			OnActorResurrectRegSet& operator=(const OnActorResurrectRegSet&) = delete;
-			OnActorResurrectRegSet& operator=(OnActorResurrectRegSet&&) = delete;
-		};
-
-
-		class OnActorReanimateStartRegSet : public SKSE::RegistrationSetUnique<const RE::Actor*, const RE::Actor*>
+		bool Empty() const
 		{
-		public:
-			using Base = SKSE::RegistrationSetUnique<const RE::Actor*, const RE::Actor*>;
-
+			return HandleIndex::GetSingleton()->GetCount(to_underlying(E)) == 0;
+		}
 
-			static OnActorReanimateStartRegSet* GetSingleton();
 
-		private:
-			OnActorReanimateStartRegSet();
-			OnActorReanimateStartRegSet(const OnActorReanimateStartRegSet&) = delete;
-			OnActorReanimateStartRegSet(OnActorReanimateStartRegSet&&) = delete;
-			~OnActorReanimateStartRegSet() = default;
-
-			OnActorReanimateStartRegSet& operator=(const OnActorReanimateStartRegSet&) = delete;
-			OnActorReanimateStartRegSet& operator=(OnActorReanimateStartRegSet&&) = delete;
-		};
-
-
-		class OnActorReanimateStopRegSet : public SKSE::RegistrationSetUnique<const RE::Actor*, const RE::Actor*>
+		std::size_t GetNumRegistrations() const
 		{
-		public:
-			using Base = SKSE::RegistrationSetUnique<const RE::Actor*, const RE::Actor*>;
-
-
-			static OnActorReanimateStopRegSet* GetSingleton();
+			std::lock_guard locker(this->_lock);
+			return MemoryStats::GetCount(GetRegistrations());
+		}
 
-		private:
-			OnActorReanimateStopRegSet();
-			OnActorReanimateStopRegSet(const OnActorReanimateStopRegSet&) = delete;
-			OnActorReanimateStopRegSet(OnActorReanimateStopRegSet&&) = delete;
-			~OnActorReanimateStopRegSet() = default;
 
-			OnActorReanimateStopRegSet& operator=(const OnActorReanimateStopRegSet&) = delete;
-			OnActorReanimateStopRegSet& operator=(OnActorReanimateStopRegSet&&) = delete;
-		};
-
-
-		class OnWeatherChangeRegSet : public SKSE::RegistrationSet<const RE::TESWeather*, const RE::TESWeather*>
+		std::size_t GetHeapSize() const
 		{
-		public:
-			using Base = SKSE::RegistrationSet<const RE::TESWeather*, const RE::TESWeather*>;
-
+			std::lock_guard locker(this->_lock);
+			return MemoryStats::GetHeapSize(GetRegistrations()) + this->_eventName.capacity();
+		}
 
-			static OnWeatherChangeRegSet* GetSingleton();
+	private:
+		Registration() :
+			Base(EVENTS[to_underlying(E)].name)
+		{}
+		Registration(const Registration&) = delete;
+		Registration(Registration&&) = delete;
+		~Registration() = default;
 
-		private:
-			OnWeatherChangeRegSet();
-			OnWeatherChangeRegSet(const OnWeatherChangeRegSet&) = delete;
-			OnWeatherChangeRegSet(OnWeatherChangeRegSet&&) = delete;
-			~OnWeatherChangeRegSet() = default;
+		Registration& operator=(const Registration&) = delete;
+		Registration& operator=(Registration&&) = delete;
 
-			OnWeatherChangeRegSet& operator=(const OnWeatherChangeRegSet&) = delete;
-			OnWeatherChangeRegSet& operator=(OnWeatherChangeRegSet&&) = delete;
-		};
 
-
-		class OnMagicEffectApplyRegMap : public SKSE::RegistrationMapUnique<const RE::TESObjectREFR*, const RE::EffectSetting*, const RE::TESForm*, bool>
+		const auto& GetRegistrations() const
 		{
-		public:
-			using Base = SKSE::RegistrationMapUnique<const RE::TESObjectREFR*, const RE::EffectSetting*, const RE::TESForm*, bool>;
-
+			if constexpr (std::is_base_of_v<SKSE::Impl::RegistrationSetBase, Base>) {
+				return this->_handles;
+			} else {
+				return this->_regs;
+			}
+		}
 
-			static OnMagicEffectApplyRegMap* GetSingleton();
 
-		private:
-			OnMagicEffectApplyRegMap();
-			OnMagicEffectApplyRegMap(const OnMagicEffectApplyRegMap&) = delete;
-			OnMagicEffectApplyRegMap(OnMagicEffectApplyRegMap&&) = delete;
-			~OnMagicEffectApplyRegMap() = default;
+		template <class U, class F>
+		static void ForEachHandle(const U&, F&&)
+		{}
 
-			OnMagicEffectApplyRegMap& operator=(const OnMagicEffectApplyRegMap&) = delete;
-			OnMagicEffectApplyRegMap& operator=(OnMagicEffectApplyRegMap&&) = delete;
-		};
-
-
-		class OnWeaponHitRegSet : public SKSE::RegistrationSetUnique<const RE::TESObjectREFR*, const RE::TESForm*, const RE::BGSProjectile*, std::uint32_t>
+		template <class F>
+		static void ForEachHandle(const std::set<RE::VMHandle>& a_handles, F&& a_func)
 		{
-		public:
-			using Base = SKSE::RegistrationSetUnique<const RE::TESObjectREFR*, const RE::TESForm*, const RE::BGSProjectile*, std::uint32_t>;
-
-
-			static OnWeaponHitRegSet* GetSingleton();
-
-		private:
-			OnWeaponHitRegSet();
-			OnWeaponHitRegSet(const OnWeaponHitRegSet&) = delete;
-			OnWeaponHitRegSet(OnWeaponHitRegSet&&) = delete;
-			~OnWeaponHitRegSet() = default;
+			for (const auto& handle : a_handles) {
+				a_func(handle);
+			}
+		}
 
-			OnWeaponHitRegSet& operator=(const OnWeaponHitRegSet&) = delete;
-			OnWeaponHitRegSet& operator=(OnWeaponHitRegSet&&) = delete;
-		};
-
-
-		class OnMagicHitRegSet : public SKSE::RegistrationSetUnique<const RE::TESObjectREFR*, const RE::TESForm*, const RE::BGSProjectile*>
+		template <class K, class V, class F>
+		static void ForEachHandle(const std::map<K, V>& a_regs, F&& a_func)
 		{
-		public:
-			using Base = SKSE::RegistrationSetUnique<const RE::TESObjectREFR*, const RE::TESForm*, const RE::BGSProjectile*>;
-
-
-			static OnMagicHitRegSet* GetSingleton();
+			for (const auto& [key, value] : a_regs) {
+				if constexpr (std::is_same_v<K, RE::VMHandle>) {
+					a_func(key);
+				} else {
+					ForEachHandle(value, a_func);
+				}
+			}
+		}
+	};
 
-		private:
-			OnMagicHitRegSet();
-			OnMagicHitRegSet(const OnMagicHitRegSet&) = delete;
-			OnMagicHitRegSet(OnMagicHitRegSet&&) = delete;
-			~OnMagicHitRegSet() = default;
 
-			OnMagicHitRegSet& operator=(const OnMagicHitRegSet&) = delete;
-			OnMagicHitRegSet& operator=(OnMagicHitRegSet&&) = delete;
-		};
+	namespace ScriptEvents
+	{
+		using OnCellFullyLoadedRegSet = Registration<EVENT::kCellFullyLoaded>;
+		using OnQuestStartRegMap = Registration<EVENT::kQuestStart>;
+		using OnQuestStopRegMap = Registration<EVENT::kQuestStop>;
+		using OnQuestStageRegMap = Registration<EVENT::kQuestStage>;
+		using OnObjectLoadedRegMap = Registration<EVENT::kObjectLoaded>;
+		using OnObjectUnloadedRegMap = Registration<EVENT::kObjectUnloaded>;
+		using OnGrabRegSet = Registration<EVENT::kGrab>;
+		using OnReleaseRegSet = Registration<EVENT::kRelease>;
+	}
 
 
-		class OnProjectileHitRegSet : public SKSE::RegistrationSetUnique<const RE::TESObjectREFR*, const RE::TESForm*, const RE::BGSProjectile*>
-		{
-		public:
-			using Base = SKSE::RegistrationSetUnique<const RE::TESObjectREFR*, const RE::TESForm*, const RE::BGSProjectile*>;
+	namespace StoryEvents
+	{
+		using OnActorKillRegSet = Registration<EVENT::kActorKill>;
+		using OnBooksReadRegSet = Registration<EVENT::kBookRead>;
+		using OnCriticalHitRegSet = Registration<EVENT::kCritHit>;
+		using OnDisarmedRegSet = Registration<EVENT::kDisarm>;
+		using OnDragonSoulsGainedRegSet = Registration<EVENT::kDragonSoul>;
+		using OnItemHarvestedRegSet = Registration<EVENT::kHarvest>;
+		using OnLevelIncreaseRegSet = Registration<EVENT::kLevelIncrease>;
+		using OnLocationDiscoveryRegSet = Registration<EVENT::kLocDiscovery>;
+		using OnShoutAttackRegSet = Registration<EVENT::kShoutAttack>;
+		using OnSkillIncreaseRegSet = Registration<EVENT::kSkillIncrease>;
+		using OnSkillIncreaseExRegMap = Registration<EVENT::kSkillIncreaseEx>;
+		using OnSoulsTrappedRegSet = Registration<EVENT::kSoulTrap>;
+		using OnSpellsLearnedRegSet = Registration<EVENT::kSpellLearned>;
+	}
 
 
-			static OnProjectileHitRegSet* GetSingleton();
+	namespace HookedEvents
+	{
+		using OnActorResurrectRegSet = Registration<EVENT::kActorResurrect>;
+		using OnActorReanimateStartRegSet = Registration<EVENT::kActorReanimateStart>;
+		using OnActorReanimateStopRegSet = Registration<EVENT::kActorReanimateStop>;
+		using OnWeatherChangeRegSet = Registration<EVENT::kWeatherChange>;
+		using OnMagicEffectApplyRegMap = Registration<EVENT::kMagicEffectApply>;
+		using OnWeaponHitRegSet = Registration<EVENT::kWeaponHit>;
+		using OnMagicHitRegSet = Registration<EVENT::kMagicHit>;
+		using OnProjectileHitRegSet = Registration<EVENT::kProjectileHit>;
+	}
 
-		private:
-			OnProjectileHitRegSet();
-			OnProjectileHitRegSet(const OnProjectileHitRegSet&) = delete;
-			OnProjectileHitRegSet(OnProjectileHitRegSet&&) = delete;
-			~OnProjectileHitRegSet() = default;
 
-			OnProjectileHitRegSet& operator=(const OnProjectileHitRegSet&) = delete;
-			OnProjectileHitRegSet& operator=(OnProjectileHitRegSet&&) = delete;
-		};
+	namespace FECEvents
+	{
+		using OnFECResetRegMap = Registration<EVENT::kFECReset>;
 	}
 
 
-	namespace FECEvents
+	template <class F, std::uint32_t... I>
+	void ForEachRegistration(F&& a_func, std::integer_sequence<std::uint32_t, I...>)
 	{
-		class OnFECResetRegMap : public SKSE::RegistrationMap<const RE::Actor*, std::uint32_t, bool>
-		{
-		public:
-			using Base = SKSE::RegistrationMap<const RE::Actor*, std::uint32_t, bool>;
+		(a_func(Registration<static_cast<EVENT>(I)>::GetSingleton()), ...);
+	}
 
 
-			static OnFECResetRegMap* GetSingleton();
+	template <class F>
+	void ForEachRegistration(F&& a_func)
+	{
+		ForEachRegistration(std::forward<F>(a_func), std::make_integer_sequence<std::uint32_t, to_underlying(EVENT::kTotal)>{});
+	}
 
-		private:
-			OnFECResetRegMap();
-			OnFECResetRegMap(const OnFECResetRegMap&) = delete;
-			OnFECResetRegMap(OnFECResetRegMap&&) = delete;
-			~OnFECResetRegMap() = default;
 
-			OnFECResetRegMap& operator=(const OnFECResetRegMap&) = delete;
-			OnFECResetRegMap& operator=(OnFECResetRegMap&&) = delete;
-		};
+	template <class Obj>
+	void UnregisterForAllEvents(Obj* a_object)
+	{
+		const auto mask = HandleIndex::GetSingleton()->GetMask(HandleIndex::GetHandle(a_object));
+		if (mask == 0) {
+			return;
+		}
+
+		ForEachRegistration([&](auto* a_regs) {
+			using Regs = std::remove_pointer_t<decltype(a_regs)>;
+			if constexpr (Regs::template Accepts<Obj>()) {
+				if ((mask & (HandleIndex::Mask(1) << to_underlying(Regs::GetEvent()))) != 0) {
+					a_regs->UnregisterObject(a_object);
+				}
+			}
+		});
 	}
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Util/MemoryStats.h"
+
 
 namespace Serialization
 {
@@ -33,9 +35,11 @@ namespace Serialization
 
 			void Clear(std::uint32_t a_add);
 			void ClearAll();
+			std::pair<std::size_t, std::size_t> GetMemoryUsage() const;
 			bool Save(SKSE::SerializationInterface* a_intfc, std::uint32_t a_type, std::uint32_t a_version, std::uint32_t a_add);
 			bool Save(SKSE::SerializationInterface* a_intfc, std::uint32_t a_add);
-			bool Load(SKSE::SerializationInterface* a_intfc, std::uint32_t a_add);
+			// a_unresolved counts entries dropped because a form no longer resolves
+			bool Load(SKSE::SerializationInterface* a_intfc, std::uint32_t a_add, std::uint32_t* a_unresolved = nullptr);
 
 		protected:
 			using Lock = std::recursive_mutex;
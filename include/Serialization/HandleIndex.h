@@ -0,0 +1,58 @@
+#pragma once
+
+
+namespace Serialization
+{
+	// reverse index : VM handle -> bitmask of event registrations it appears in
+	// each (handle, event) pair counts its registrations, so filtered events drop the bit with the last filter
+	class HandleIndex
+	{
+	public:
+		using Mask = std::uint64_t;
+
+		static constexpr std::uint32_t MAX_EVENTS = 64;
+
+
+		static HandleIndex* GetSingleton();
+
+		static RE::VMHandle GetHandle(const RE::TESForm* a_form);
+		static RE::VMHandle GetHandle(const RE::BGSBaseAlias* a_alias);
+		static RE::VMHandle GetHandle(const RE::ActiveEffect* a_activeEffect);
+
+		void Add(RE::VMHandle a_handle, std::uint32_t a_event);
+		void Remove(RE::VMHandle a_handle, std::uint32_t a_event);
+		void RemoveAll(RE::VMHandle a_handle, std::uint32_t a_event);
+		void Clear(std::uint32_t a_event);
+
+		Mask GetMask(RE::VMHandle a_handle) const;
+		std::size_t GetCount(std::uint32_t a_event) const;
+
+	private:
+		using Lock = std::mutex;
+		using Locker = std::lock_guard<Lock>;
+
+		HandleIndex() = default;
+		HandleIndex(const HandleIndex&) = delete;
+		HandleIndex(HandleIndex&&) = delete;
+		~HandleIndex() = default;
+
+		HandleIndex& operator=(const HandleIndex&) = delete;
+		HandleIndex& operator=(HandleIndex&&) = delete;
+
+		struct Entry
+		{
+			Mask mask{ 0 };
+			std::map<std::uint32_t, std::uint32_t> refs;  //event -> registrations of this handle
+		};
+
+
+		static RE::VMHandle GetHandle(RE::VMTypeID a_typeID, const void* a_object);
+
+		// caller holds _lock
+		void Erase(std::unordered_map<RE::VMHandle, Entry>::iterator a_it, std::uint32_t a_event);
+
+		std::unordered_map<RE::VMHandle, Entry> _entries;
+		std::array<std::size_t, MAX_EVENTS> _counts{};  //handles per event
+		mutable Lock _lock;
+	};
+}
@@ -32,6 +32,7 @@ namespace Serialization
 		kLevelIncrease = 'LEVL',
 		kLocDiscovery = 'DISC',
 		kSkillIncrease = 'SKIL',
+		kSkillIncreaseEx = 'SKLX',
 		kSoulTrap = 'SOUL',
 		kShoutAttack = 'SHOU',
 		kSpellLearned = 'SPEL',
@@ -45,11 +46,14 @@ namespace Serialization
 		kMagicHit = 'MHIT',
 		kProjectileHit = 'PHIT',
 
-		kFECReset = 'FECR'
+		kFECReset = 'FECR',
+
+		kConditionalEvents = 'CNDE'
 	};
 	
 	std::string DecodeTypeCode(std::uint32_t a_typeCode);
 	
 	void SaveCallback(SKSE::SerializationInterface* a_intfc);
+	void RevertCallback(SKSE::SerializationInterface* a_intfc);
 	void LoadCallback(SKSE::SerializationInterface* a_intfc);
 }
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+
+namespace Serialization
+{
+	// per record entries, bytes, unresolved IDs and time, for the last co-save write and read
+	// counted by the save/load helpers in Manager.cpp, the SKSE interface is used as is
+	class Telemetry
+	{
+	public:
+		enum class MODE : std::uint32_t
+		{
+			kSave,
+			kLoad
+		};
+
+
+		struct Record
+		{
+			std::uint32_t type;
+			std::size_t entries;
+			std::optional<std::uint64_t> bytes;  //unknown for records whose layout CommonLib writes
+			std::uint32_t unresolved;
+			double time;
+		};
+
+
+		static Telemetry* GetSingleton();
+
+		void Begin(MODE a_mode);
+		void BeginRecord(std::uint32_t a_type);
+		void EndRecord(std::size_t a_entries, std::optional<std::uint64_t> a_bytes, std::uint32_t a_unresolved = 0);
+		void End();
+
+		std::vector<std::string> GetReport() const;
+
+	private:
+		using Lock = std::mutex;
+		using Locker = std::lock_guard<Lock>;
+		using Clock = std::chrono::steady_clock;
+
+		Telemetry() = default;
+		Telemetry(const Telemetry&) = delete;
+		Telemetry(Telemetry&&) = delete;
+		~Telemetry() = default;
+
+		Telemetry& operator=(const Telemetry&) = delete;
+		Telemetry& operator=(Telemetry&&) = delete;
+
+		std::vector<Record>& GetRecords(MODE a_mode);
+
+		std::vector<Record> _save;
+		std::vector<Record> _load;
+		MODE _mode{ MODE::kSave };
+		Record _current{};
+		Clock::time_point _recordStart;
+		Clock::time_point _start;
+		mutable Lock _lock;
+	};
+}
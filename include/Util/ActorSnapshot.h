@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Util/Spatial.h"
+
+
+namespace Actors
+{
+	// process list actors, resolved on first use each frame and shared by the natives that scan them
+	// the snapshot holds a reference to every actor in it, so its pointers stay valid while it's held
+	class Snapshot
+	{
+	public:
+		enum LEVEL : std::uint32_t
+		{
+			kHigh,
+			kMiddleHigh,
+			kMiddleLow,
+			kLow,
+
+			kTotal
+		};
+
+
+		static std::shared_ptr<const Snapshot> Get();
+
+		// the next Get builds a new snapshot, after keyword edits or before a save loads
+		static void Invalidate();
+
+		const std::vector<RE::NiPointer<RE::Actor>>& GetActors(LEVEL a_level) const { return _levels[a_level]; }
+
+		// high process actors, then the player
+		const Spatial::ActorPositions& GetPositions() const { return _positions; }
+
+		// by position index
+		const char* GetName(std::size_t a_index) const { return _names[a_index]; }
+
+		// false if neither the actor's base nor its race has the keyword, so HasKeyword can be skipped
+		bool MayHaveKeyword(std::size_t a_index, const RE::BGSKeyword* a_keyword) const;
+
+	private:
+		static std::uint64_t GetKeywordBit(const RE::BGSKeyword* a_keyword);
+
+		void Build();
+		void AddPosition(RE::Actor* a_actor);
+
+		std::array<std::vector<RE::NiPointer<RE::Actor>>, kTotal> _levels;
+		Spatial::ActorPositions _positions;
+		std::vector<const char*> _names;
+		std::vector<std::uint64_t> _signatures;
+	};
+}
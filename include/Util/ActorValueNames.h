@@ -0,0 +1,11 @@
+#pragma once
+
+
+// interned actor value enum names, built once the actor value list is loaded
+namespace ActorValueNames
+{
+	void Build();
+
+	// empty if the table isn't built or the actor value has no name
+	const RE::BSFixedString& Get(RE::ActorValue a_actorValue);
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Util/ConditionParser.h"
+
+
+namespace Condition
+{
+	// parsed condition lists keyed by a hash of their strings, with one evaluation chain per list,
+	// and formatted condition lists keyed by condition
+	class Cache
+	{
+	public:
+		// freed with its last owner, so chains stay valid for registrations after the cache drops them
+		using Chain = std::shared_ptr<const RE::TESConditionItem>;
+
+
+		static Cache* GetSingleton();
+
+		// a new chain for an effect to own, in reverse list order as AddMagicEffectToSpell has always built it
+		// the game deletes these items with their effect, so only the parsed list is shared
+		RE::TESConditionItem* CreateChain(const std::vector<RE::BSFixedString>& a_conditionList);
+
+		// same, for conditions parsed elsewhere
+		static RE::TESConditionItem* CreateChain(const ConditionDataVec& a_conditions);
+
+		// a new reversed copy of a chain, as AddEffectItemToSpell has always built it
+		static RE::TESConditionItem* CopyChain(const RE::TESConditionItem* a_head);
+
+		// in list order, for evaluating the list as written
+		// shared with the cache : don't edit it or hand it to a game TESCondition
+		Chain GetOrderedChain(const std::vector<RE::BSFixedString>& a_conditionList);
+
+		// rebuilt if the chain head changed since it was formatted
+		std::vector<RE::BSFixedString> GetConditionList(const RE::TESCondition* a_conditions);
+
+		// call after editing a condition chain in place
+		void Invalidate(const RE::TESCondition* a_conditions);
+
+		// on game load, lists are parsed again as they are used
+		void Clear();
+
+		// parsed and formatted lists, estimated heap size
+		std::pair<std::size_t, std::size_t> GetMemoryUsage() const;
+
+	private:
+		using Lock = std::mutex;
+		using Locker = std::lock_guard<Lock>;
+
+		static constexpr std::size_t MAX_ENTRIES = 1024;  //parsed lists kept before the cache starts over
+
+
+		struct Entry
+		{
+			std::vector<RE::BSFixedString> key;
+			ConditionDataVec conditions;
+			Chain orderedChain;
+		};
+
+
+		struct Formatted
+		{
+			const RE::TESConditionItem* head;
+			std::vector<RE::BSFixedString> conditions;
+		};
+
+
+		Cache() = default;
+		Cache(const Cache&) = delete;
+		Cache(Cache&&) = delete;
+		~Cache() = default;
+
+		Cache& operator=(const Cache&) = delete;
+		Cache& operator=(Cache&&) = delete;
+
+		static std::uint64_t Hash(const std::vector<RE::BSFixedString>& a_conditionList);
+		static bool IsMatch(const std::vector<RE::BSFixedString>& a_lhs, const std::vector<RE::BSFixedString>& a_rhs);
+		static RE::CONDITION_ITEM_DATA GetItemData(const ConditionData& a_condition);
+		template <class It>
+		static Chain BuildChain(It a_first, It a_last);
+		static void DeleteChain(const RE::TESConditionItem* a_head);
+
+		const Entry& GetEntry(const std::vector<RE::BSFixedString>& a_conditionList);
+
+		std::unordered_map<std::uint64_t, std::vector<Entry>> _cache;  //lists whose hashes collide share a bucket
+		std::size_t _entries{ 0 };
+		std::unordered_map<const RE::TESCondition*, Formatted> _formatted;
+		mutable Lock _lock;
+	};
+}
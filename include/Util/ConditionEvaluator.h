@@ -0,0 +1,43 @@
+#pragma once
+
+
+namespace Condition
+{
+	// item results for one batch or matching call, so an item shared by several effects is checked once per pair of refs
+	// keep it local to the call : results aren't invalidated, and functions like GetRandomPercent would repeat
+	class Memo
+	{
+	public:
+		std::optional<bool> Find(const RE::TESConditionItem* a_item, const RE::TESObjectREFR* a_actionRef, const RE::TESObjectREFR* a_target) const;
+		void Insert(const RE::TESConditionItem* a_item, const RE::TESObjectREFR* a_actionRef, const RE::TESObjectREFR* a_target, bool a_result);
+
+	private:
+		struct Key
+		{
+			bool operator==(const Key& a_rhs) const;
+
+			const RE::TESConditionItem* item;
+			const RE::TESObjectREFR* actionRef;
+			const RE::TESObjectREFR* target;
+		};
+
+
+		struct KeyHash
+		{
+			std::size_t operator()(const Key& a_key) const;
+		};
+
+
+		std::unordered_map<Key, bool, KeyHash> _results;
+	};
+
+
+	// evaluates in list order, OR binds tighter than AND : (a OR b) AND (c OR d)
+	// stops at the first failing group. item results are only reused through a_memo
+	bool IsTrue(const RE::TESConditionItem* a_head, RE::TESObjectREFR* a_actionRef, RE::TESObjectREFR* a_target, Memo* a_memo = nullptr);
+	bool IsTrue(const RE::TESCondition& a_conditions, RE::TESObjectREFR* a_actionRef, RE::TESObjectREFR* a_target, Memo* a_memo = nullptr);
+
+	// spells, enchantments, ingredients, potions and scrolls pass if any effect and its base effect pass
+	// magic effects pass if their conditions pass, other forms always pass
+	bool IsTrue(const RE::TESForm& a_form, RE::TESObjectREFR* a_actionRef, RE::TESObjectREFR* a_target, Memo* a_memo = nullptr);
+}
@@ -16,815 +16,487 @@ namespace Condition
 
 	namespace MAP
 	{
-		inline constexpr frozen::map<std::uint32_t, frozen::string, 402> funcID = {
-			{ 0, "GetWantBlocking" },
-			{ 1, "GetDistance" },
-			{ 5, "GetLocked" },
-			{ 6, "GetPos" },
-			{ 8, "GetAngle" },
-			{ 10, "GetStartingPos" },
-			{ 11, "GetStartingAngle" },
-			{ 12, "GetSecondsPassed" },
-			{ 14, "GetActorValue" },
-			{ 18, "GetCurrentTime" },
-			{ 24, "GetScale" },
-			{ 25, "IsMoving" },
-			{ 26, "IsTurning" },
-			{ 27, "GetLineOfSight" },
-			{ 32, "GetInSameCell" },
-			{ 35, "GetDisabled" },
-			{ 36, "MenuMode" },
-			{ 39, "GetDisease" },
-			{ 41, "GetClothingValue" },
-			{ 42, "SameFaction" },
-			{ 43, "SameRace" },
-			{ 44, "SameSex" },
-			{ 45, "GetDetected" },
-			{ 46, "GetDead" },
-			{ 47, "GetItemCount" },
-			{ 48, "GetGold" },
-			{ 49, "GetSleeping" },
-			{ 50, "GetTalkedToPC" },
-			{ 53, "GetScriptVariable" },
-			{ 56, "GetQuestRunning" },
-			{ 58, "GetStage" },
-			{ 59, "GetStageDone" },
-			{ 60, "GetFactionRankDifference" },
-			{ 61, "GetAlarmed" },
-			{ 62, "IsRaining" },
-			{ 63, "GetAttacked" },
-			{ 64, "GetIsCreature" },
-			{ 65, "GetLockLevel" },
-			{ 66, "GetShouldAttack" },
-			{ 67, "GetInCell" },
-			{ 68, "GetIsClass" },
-			{ 69, "GetIsRace" },
-			{ 70, "GetIsSex" },
-			{ 71, "GetInFaction" },
-			{ 72, "GetIsID" },
-			{ 73, "GetFactionRank" },
-			{ 74, "GetGlobalValue" },
-			{ 75, "IsSnowing" },
-			{ 77, "GetRandomPercent" },
-			{ 79, "GetQuestVariable" },
-			{ 80, "GetLevel" },
-			{ 81, "IsRotating" },
-			{ 84, "GetDeadCount" },
-			{ 91, "GetIsAlerted" },
-			{ 98, "GetPlayerControlsDisabled" },
-			{ 99, "GetHeadingAngle" },
-			{ 101, "IsWeaponMagicOut" },
-			{ 102, "IsTorchOut" },
-			{ 103, "IsShieldOut" },
-			{ 106, "IsFacingUp" },
-			{ 107, "GetKnockedState" },
-			{ 108, "GetWeaponAnimType" },
-			{ 109, "IsWeaponSkillType" },
-			{ 110, "GetCurrentAIPackage" },
-			{ 111, "IsWaiting" },
-			{ 112, "IsIdlePlaying" },
-			{ 116, "IsIntimidatedbyPlayer" },
-			{ 117, "IsPlayerInRegion" },
-			{ 118, "GetActorAggroRadiusViolated" },
-			{ 122, "GetCrime" },
-			{ 123, "IsGreetingPlayer" },
-			{ 125, "IsGuard" },
-			{ 127, "HasBeenEaten" },
-			{ 128, "GetStaminaPercentage" },
-			{ 129, "GetPCIsClass" },
-			{ 130, "GetPCIsRace" },
-			{ 131, "GetPCIsSex" },
-			{ 132, "GetPCInFaction" },
-			{ 133, "SameFactionAsPC" },
-			{ 134, "SameRaceAsPC" },
-			{ 135, "SameSexAsPC" },
-			{ 136, "GetIsReference" },
-			{ 141, "IsTalking" },
-			{ 142, "GetWalkSpeed" },
-			{ 143, "GetCurrentAIProcedure" },
-			{ 144, "GetTrespassWarningLevel" },
-			{ 145, "IsTrespassing" },
-			{ 146, "IsInMyOwnedCell" },
-			{ 147, "GetWindSpeed" },
-			{ 148, "GetCurrentWeatherPercent" },
-			{ 149, "GetIsCurrentWeather" },
-			{ 150, "IsContinuingPackagePCNear" },
-			{ 152, "GetIsCrimeFaction" },
-			{ 153, "CanHaveFlames" },
-			{ 154, "HasFlames" },
-			{ 157, "GetOpenState" },
-			{ 159, "GetSitting" },
-			{ 161, "GetIsCurrentPackage" },
-			{ 162, "IsCurrentFurnitureRef" },
-			{ 163, "IsCurrentFurnitureObj" },
-			{ 170, "GetDayOfWeek" },
-			{ 172, "GetTalkedToPCParam" },
-			{ 175, "IsPCSleeping" },
-			{ 176, "IsPCAMurderer" },
-			{ 180, "HasSameEditorLocAsRef" },
-			{ 181, "HasSameEditorLocAsRefAlias" },
-			{ 182, "GetEquipped" },
-			{ 185, "IsSwimming" },
-			{ 190, "GetAmountSoldStolen" },
-			{ 192, "GetIgnoreCrime" },
-			{ 193, "GetPCExpelled" },
-			{ 195, "GetPCFactionMurder" },
-			{ 197, "GetPCEnemyofFaction" },
-			{ 199, "GetPCFactionAttack" },
-			{ 203, "GetDestroyed" },
-			{ 214, "HasMagicEffect" },
-			{ 215, "GetDefaultOpen" },
-			{ 219, "GetAnimAction" },
-			{ 223, "IsSpellTarget" },
-			{ 224, "GetVATSMode" },
-			{ 225, "GetPersuasionNumber" },
-			{ 226, "GetVampireFeed" },
-			{ 227, "GetCannibal" },
-			{ 228, "GetIsClassDefault" },
-			{ 229, "GetClassDefaultMatch" },
-			{ 230, "GetInCellParam" },
-			{ 235, "GetVatsTargetHeight" },
-			{ 237, "GetIsGhost" },
-			{ 242, "GetUnconscious" },
-			{ 244, "GetRestrained" },
-			{ 246, "GetIsUsedItem" },
-			{ 247, "GetIsUsedItemType" },
-			{ 248, "IsScenePlaying" },
-			{ 249, "IsInDialogueWithPlayer" },
-			{ 250, "GetLocationCleared" },
-			{ 254, "GetIsPlayableRace" },
-			{ 255, "GetOffersServicesNow" },
-			{ 258, "HasAssociationType" },
-			{ 259, "HasFamilyRelationship" },
-			{ 261, "HasParentRelationship" },
-			{ 262, "IsWarningAbout" },
-			{ 263, "IsWeaponOut" },
-			{ 264, "HasSpell" },
-			{ 265, "IsTimePassing" },
-			{ 266, "IsPleasant" },
-			{ 267, "IsCloudy" },
-			{ 274, "IsSmallBump" },
-			{ 277, "GetBaseActorValue" },
-			{ 278, "IsOwner" },
-			{ 280, "IsCellOwner" },
-			{ 282, "IsHorseStolen" },
-			{ 285, "IsLeftUp" },
-			{ 286, "IsSneaking" },
-			{ 287, "IsRunning" },
-			{ 288, "GetFriendHit" },
-			{ 289, "IsInCombat" },
-			{ 300, "IsInInterior" },
-			{ 304, "IsWaterObject" },
-			{ 305, "GetPlayerAction" },
-			{ 306, "IsActorUsingATorch" },
-			{ 309, "IsXBox" },
-			{ 310, "GetInWorldspace" },
-			{ 312, "GetPCMiscStat" },
-			{ 313, "GetPairedAnimation" },
-			{ 314, "IsActorAVictim" },
-			{ 315, "GetTotalPersuasionNumber" },
-			{ 318, "GetIdleDoneOnce" },
-			{ 320, "GetNoRumors" },
-			{ 323, "GetCombatState" },
-			{ 325, "GetWithinPackageLocation" },
-			{ 327, "IsRidingMount" },
-			{ 329, "IsFleeing" },
-			{ 332, "IsInDangerousWater" },
-			{ 338, "GetIgnoreFriendlyHits" },
-			{ 339, "IsPlayersLastRiddenMount" },
-			{ 353, "IsActor" },
-			{ 354, "IsEssential" },
-			{ 358, "IsPlayerMovingIntoNewSpace" },
-			{ 359, "GetInCurrentLoc" },
-			{ 360, "GetInCurrentLocAlias" },
-			{ 361, "GetTimeDead" },
-			{ 362, "HasLinkedRef" },
-			{ 365, "IsChild" },
-			{ 366, "GetStolenItemValueNoCrime" },
-			{ 367, "GetLastPlayerAction" },
-			{ 368, "IsPlayerActionActive" },
-			{ 370, "IsTalkingActivatorActor" },
-			{ 372, "IsInList" },
-			{ 373, "GetStolenItemValue" },
-			{ 375, "GetCrimeGoldViolent" },
-			{ 376, "GetCrimeGoldNonviolent" },
-			{ 378, "HasShout" },
-			{ 381, "GetHasNote" },
-			{ 390, "GetHitLocation" },
-			{ 391, "IsPC1stPerson" },
-			{ 396, "GetCauseofDeath" },
-			{ 397, "IsLimbGone" },
-			{ 398, "IsWeaponInList" },
-			{ 402, "IsBribedbyPlayer" },
-			{ 403, "GetRelationshipRank" },
-			{ 407, "GetVATSValue" },
-			{ 408, "IsKiller" },
-			{ 409, "IsKillerObject" },
-			{ 410, "GetFactionCombatReaction" },
-			{ 414, "Exists" },
-			{ 415, "GetGroupMemberCount" },
-			{ 416, "GetGroupTargetCount" },
-			{ 426, "GetIsVoiceType" },
-			{ 427, "GetPlantedExplosive" },
-			{ 429, "IsScenePackageRunning" },
-			{ 430, "GetHealthPercentage" },
-			{ 432, "GetIsObjectType" },
-			{ 434, "GetDialogueEmotion" },
-			{ 435, "GetDialogueEmotionValue" },
-			{ 437, "GetIsCreatureType" },
-			{ 444, "GetInCurrentLocFormList" },
-			{ 445, "GetInZone" },
-			{ 446, "GetVelocity" },
-			{ 447, "GetGraphVariableFloat" },
-			{ 448, "HasPerk" },
-			{ 449, "GetFactionRelation" },
-			{ 450, "IsLastIdlePlayed" },
-			{ 453, "GetPlayerTeammate" },
-			{ 454, "GetPlayerTeammateCount" },
-			{ 458, "GetActorCrimePlayerEnemy" },
-			{ 459, "GetCrimeGold" },
-			{ 463, "IsPlayerGrabbedRef" },
-			{ 465, "GetKeywordItemCount" },
-			{ 470, "GetDestructionStage" },
-			{ 473, "GetIsAlignment" },
-			{ 476, "IsProtected" },
-			{ 477, "GetThreatRatio" },
-			{ 479, "GetIsUsedItemEquipType" },
-			{ 487, "IsCarryable" },
-			{ 488, "GetConcussed" },
-			{ 491, "GetMapMarkerVisible" },
-			{ 493, "PlayerKnows" },
-			{ 494, "GetPermanentActorValue" },
-			{ 495, "GetKillingBlowLimb" },
-			{ 497, "CanPayCrimeGold" },
-			{ 499, "GetDaysInJail" },
-			{ 500, "EPAlchemyGetMakingPoison" },
-			{ 501, "EPAlchemyEffectHasKeyword" },
-			{ 503, "GetAllowWorldInteractions" },
-			{ 508, "GetLastHitCritical" },
-			{ 513, "IsCombatTarget" },
-			{ 515, "GetVATSRightAreaFree" },
-			{ 516, "GetVATSLeftAreaFree" },
-			{ 517, "GetVATSBackAreaFree" },
-			{ 518, "GetVATSFrontAreaFree" },
-			{ 519, "GetLockIsBroken" },
-			{ 520, "IsPS3" },
-			{ 521, "IsWin32" },
-			{ 522, "GetVATSRightTargetVisible" },
-			{ 523, "GetVATSLeftTargetVisible" },
-			{ 524, "GetVATSBackTargetVisible" },
-			{ 525, "GetVATSFrontTargetVisible" },
-			{ 528, "IsInCriticalStage" },
-			{ 530, "GetXPForNextLevel" },
-			{ 533, "GetInfamy" },
-			{ 534, "GetInfamyViolent" },
-			{ 535, "GetInfamyNonViolent" },
-			{ 543, "GetQuestCompleted" },
-			{ 547, "IsGoreDisabled" },
-			{ 550, "IsSceneActionComplete" },
-			{ 552, "GetSpellUsageNum" },
-			{ 554, "GetActorsInHigh" },
-			{ 555, "HasLoaded3D" },
-			{ 560, "HasKeyword" },
-			{ 561, "HasRefType" },
-			{ 562, "LocationHasKeyword" },
-			{ 563, "LocationHasRefType" },
-			{ 565, "GetIsEditorLocation" },
-			{ 566, "GetIsAliasRef" },
-			{ 567, "GetIsEditorLocAlias" },
-			{ 568, "IsSprinting" },
-			{ 569, "IsBlocking" },
-			{ 570, "HasEquippedSpell" },
-			{ 571, "GetCurrentCastingType" },
-			{ 572, "GetCurrentDeliveryType" },
-			{ 574, "GetAttackState" },
-			{ 576, "GetEventData" },
-			{ 577, "IsCloserToAThanB" },
-			{ 579, "GetEquippedShout" },
-			{ 580, "IsBleedingOut" },
-			{ 584, "GetRelativeAngle" },
-			{ 589, "GetMovementDirection" },
-			{ 590, "IsInScene" },
-			{ 591, "GetRefTypeDeadCount" },
-			{ 592, "GetRefTypeAliveCount" },
-			{ 594, "GetIsFlying" },
-			{ 595, "IsCurrentSpell" },
-			{ 596, "SpellHasKeyword" },
-			{ 597, "GetEquippedItemType" },
-			{ 598, "GetLocationAliasCleared" },
-			{ 600, "GetLocAliasRefTypeDeadCount" },
-			{ 601, "GetLocAliasRefTypeAliveCount" },
-			{ 602, "IsWardState" },
-			{ 603, "IsInSameCurrentLocAsRef" },
-			{ 604, "IsInSameCurrentLocAsRefAlias" },
-			{ 605, "LocAliasIsLocation" },
-			{ 606, "GetKeywordDataForLocation" },
-			{ 608, "GetKeywordDataForAlias" },
-			{ 610, "LocAliasHasKeyword" },
-			{ 611, "IsNullPackageData" },
-			{ 612, "GetNumericPackageData" },
-			{ 613, "IsFurnitureAnimType" },
-			{ 614, "IsFurnitureEntryType" },
-			{ 615, "GetHighestRelationshipRank" },
-			{ 616, "GetLowestRelationshipRank" },
-			{ 617, "HasAssociationTypeAny" },
-			{ 618, "HasFamilyRelationshipAny" },
-			{ 619, "GetPathingTargetOffset" },
-			{ 620, "GetPathingTargetAngleOffset" },
-			{ 621, "GetPathingTargetSpeed" },
-			{ 622, "GetPathingTargetSpeedAngle" },
-			{ 623, "GetMovementSpeed" },
-			{ 624, "GetInContainer" },
-			{ 625, "IsLocationLoaded" },
-			{ 626, "IsLocAliasLoaded" },
-			{ 627, "IsDualCasting" },
-			{ 629, "GetVMQuestVariable" },
-			{ 630, "GetVMScriptVariable" },
-			{ 631, "IsEnteringInteractionQuick" },
-			{ 632, "IsCasting" },
-			{ 633, "GetFlyingState" },
-			{ 635, "IsInFavorState" },
-			{ 636, "HasTwoHandedWeaponEquipped" },
-			{ 637, "IsExitingInstant" },
-			{ 638, "IsInFriendStateWithPlayer" },
-			{ 639, "GetWithinDistance" },
-			{ 640, "GetActorValuePercent" },
-			{ 641, "IsUnique" },
-			{ 642, "GetLastBumpDirection" },
-			{ 644, "IsInFurnitureState" },
-			{ 645, "GetIsInjured" },
-			{ 646, "GetIsCrashLandRequest" },
-			{ 647, "GetIsHastyLandRequest" },
-			{ 650, "IsLinkedTo" },
-			{ 651, "GetKeywordDataForCurrentLocation" },
-			{ 652, "GetInSharedCrimeFaction" },
-			{ 654, "GetBribeSuccess" },
-			{ 655, "GetIntimidateSuccess" },
-			{ 656, "GetArrestedState" },
-			{ 657, "GetArrestingActor" },
-			{ 659, "EPTemperingItemIsEnchanted" },
-			{ 660, "EPTemperingItemHasKeyword" },
-			{ 664, "GetReplacedItemType" },
-			{ 672, "IsAttacking" },
-			{ 673, "IsPowerAttacking" },
-			{ 674, "IsLastHostileActor" },
-			{ 675, "GetGraphVariableInt" },
-			{ 676, "GetCurrentShoutVariation" },
-			{ 678, "ShouldAttackKill" },
-			{ 680, "GetActivatorHeight" },
-			{ 681, "EPMagic_IsAdvanceSkill" },
-			{ 682, "WornHasKeyword" },
-			{ 683, "GetPathingCurrentSpeed" },
-			{ 684, "GetPathingCurrentSpeedAngle" },
-			{ 691, "EPModSkillUsage_AdvanceObjectHasKeyword" },
-			{ 692, "EPModSkillUsage_IsAdvanceAction" },
-			{ 693, "EPMagic_SpellHasKeyword" },
-			{ 694, "GetNoBleedoutRecovery" },
-			{ 696, "EPMagic_SpellHasSkill" },
-			{ 697, "IsAttackType" },
-			{ 698, "IsAllowedToFly" },
-			{ 699, "HasMagicEffectKeyword" },
-			{ 700, "IsCommandedActor" },
-			{ 701, "IsStaggered" },
-			{ 702, "IsRecoiling" },
-			{ 703, "IsExitingInteractionQuick" },
-			{ 704, "IsPathing" },
-			{ 705, "GetShouldHelp" },
-			{ 706, "HasBoundWeaponEquipped" },
-			{ 707, "GetCombatTargetHasKeyword" },
-			{ 709, "GetCombatGroupMemberCount" },
-			{ 710, "IsIgnoringCombat" },
-			{ 711, "GetLightLevel" },
-			{ 713, "SpellHasCastingPerk" },
-			{ 714, "IsBeingRidden" },
-			{ 715, "IsUndead" },
-			{ 716, "GetRealHoursPassed" },
-			{ 718, "IsUnlockedDoor" },
-			{ 719, "IsHostileToActor" },
-			{ 720, "GetTargetHeight" },
-			{ 721, "IsPoison" },
-			{ 722, "WornApparelHasKeywordCount" },
-			{ 723, "GetItemHealthPercent" },
-			{ 724, "EffectWasDualCast" },
-			{ 725, "GetKnockedStateEnum" },
-			{ 726, "DoesNotExist" },
-			{ 730, "IsOnFlyingMount" },
-			{ 731, "CanFlyHere" },
-			{ 732, "IsFlyingMountPatrolQueud" },
-			{ 733, "IsFlyingMountFastTravelling" },
-			{ 734, "IsOverEncumbered" },
-			{ 735, "GetActorWarmth" },
-			{ 1024, "GetSKSEVersion" },
-			{ 1025, "GetSKSEVersionMinor" },
-			{ 1026, "GetSKSEVersionBeta" },
-			{ 1027, "GetSKSERelease" },
-			{ 1028, "ClearInvalidRegistrations" },
-		};
-		inline constexpr frozen::map<frozen::string, std::uint32_t, 402> funcID_reverse = {
-			{ "GetWantBlocking", 0 },
-			{ "GetDistance", 1 },
-			{ "GetLocked", 5 },
-			{ "GetPos", 6 },
-			{ "GetAngle", 8 },
-			{ "GetStartingPos", 10 },
-			{ "GetStartingAngle", 11 },
-			{ "GetSecondsPassed", 12 },
-			{ "GetActorValue", 14 },
-			{ "GetCurrentTime", 18 },
-			{ "GetScale", 24 },
-			{ "IsMoving", 25 },
-			{ "IsTurning", 26 },
-			{ "GetLineOfSight", 27 },
-			{ "GetInSameCell", 32 },
-			{ "GetDisabled", 35 },
-			{ "MenuMode", 36 },
-			{ "GetDisease", 39 },
-			{ "GetClothingValue", 41 },
-			{ "SameFaction", 42 },
-			{ "SameRace", 43 },
-			{ "SameSex", 44 },
-			{ "GetDetected", 45 },
-			{ "GetDead", 46 },
-			{ "GetItemCount", 47 },
-			{ "GetGold", 48 },
-			{ "GetSleeping", 49 },
-			{ "GetTalkedToPC", 50 },
-			{ "GetScriptVariable", 53 },
-			{ "GetQuestRunning", 56 },
-			{ "GetStage", 58 },
-			{ "GetStageDone", 59 },
-			{ "GetFactionRankDifference", 60 },
-			{ "GetAlarmed", 61 },
-			{ "IsRaining", 62 },
-			{ "GetAttacked", 63 },
-			{ "GetIsCreature", 64 },
-			{ "GetLockLevel", 65 },
-			{ "GetShouldAttack", 66 },
-			{ "GetInCell", 67 },
-			{ "GetIsClass", 68 },
-			{ "GetIsRace", 69 },
-			{ "GetIsSex", 70 },
-			{ "GetInFaction", 71 },
-			{ "GetIsID", 72 },
-			{ "GetFactionRank", 73 },
-			{ "GetGlobalValue", 74 },
-			{ "IsSnowing", 75 },
-			{ "GetRandomPercent", 77 },
-			{ "GetQuestVariable", 79 },
-			{ "GetLevel", 80 },
-			{ "IsRotating", 81 },
-			{ "GetDeadCount", 84 },
-			{ "GetIsAlerted", 91 },
-			{ "GetPlayerControlsDisabled", 98 },
-			{ "GetHeadingAngle", 99 },
-			{ "IsWeaponMagicOut", 101 },
-			{ "IsTorchOut", 102 },
-			{ "IsShieldOut", 103 },
-			{ "IsFacingUp", 106 },
-			{ "GetKnockedState", 107 },
-			{ "GetWeaponAnimType", 108 },
-			{ "IsWeaponSkillType", 109 },
-			{ "GetCurrentAIPackage", 110 },
-			{ "IsWaiting", 111 },
-			{ "IsIdlePlaying", 112 },
-			{ "IsIntimidatedbyPlayer", 116 },
-			{ "IsPlayerInRegion", 117 },
-			{ "GetActorAggroRadiusViolated", 118 },
-			{ "GetCrime", 122 },
-			{ "IsGreetingPlayer", 123 },
-			{ "IsGuard", 125 },
-			{ "HasBeenEaten", 127 },
-			{ "GetStaminaPercentage", 128 },
-			{ "GetPCIsClass", 129 },
-			{ "GetPCIsRace", 130 },
-			{ "GetPCIsSex", 131 },
-			{ "GetPCInFaction", 132 },
-			{ "SameFactionAsPC", 133 },
-			{ "SameRaceAsPC", 134 },
-			{ "SameSexAsPC", 135 },
-			{ "GetIsReference", 136 },
-			{ "IsTalking", 141 },
-			{ "GetWalkSpeed", 142 },
-			{ "GetCurrentAIProcedure", 143 },
-			{ "GetTrespassWarningLevel", 144 },
-			{ "IsTrespassing", 145 },
-			{ "IsInMyOwnedCell", 146 },
-			{ "GetWindSpeed", 147 },
-			{ "GetCurrentWeatherPercent", 148 },
-			{ "GetIsCurrentWeather", 149 },
-			{ "IsContinuingPackagePCNear", 150 },
-			{ "GetIsCrimeFaction", 152 },
-			{ "CanHaveFlames", 153 },
-			{ "HasFlames", 154 },
-			{ "GetOpenState", 157 },
-			{ "GetSitting", 159 },
-			{ "GetIsCurrentPackage", 161 },
-			{ "IsCurrentFurnitureRef", 162 },
-			{ "IsCurrentFurnitureObj", 163 },
-			{ "GetDayOfWeek", 170 },
-			{ "GetTalkedToPCParam", 172 },
-			{ "IsPCSleeping", 175 },
-			{ "IsPCAMurderer", 176 },
-			{ "HasSameEditorLocAsRef", 180 },
-			{ "HasSameEditorLocAsRefAlias", 181 },
-			{ "GetEquipped", 182 },
-			{ "IsSwimming", 185 },
-			{ "GetAmountSoldStolen", 190 },
-			{ "GetIgnoreCrime", 192 },
-			{ "GetPCExpelled", 193 },
-			{ "GetPCFactionMurder", 195 },
-			{ "GetPCEnemyofFaction", 197 },
-			{ "GetPCFactionAttack", 199 },
-			{ "GetDestroyed", 203 },
-			{ "HasMagicEffect", 214 },
-			{ "GetDefaultOpen", 215 },
-			{ "GetAnimAction", 219 },
-			{ "IsSpellTarget", 223 },
-			{ "GetVATSMode", 224 },
-			{ "GetPersuasionNumber", 225 },
-			{ "GetVampireFeed", 226 },
-			{ "GetCannibal", 227 },
-			{ "GetIsClassDefault", 228 },
-			{ "GetClassDefaultMatch", 229 },
-			{ "GetInCellParam", 230 },
-			{ "GetVatsTargetHeight", 235 },
-			{ "GetIsGhost", 237 },
-			{ "GetUnconscious", 242 },
-			{ "GetRestrained", 244 },
-			{ "GetIsUsedItem", 246 },
-			{ "GetIsUsedItemType", 247 },
-			{ "IsScenePlaying", 248 },
-			{ "IsInDialogueWithPlayer", 249 },
-			{ "GetLocationCleared", 250 },
-			{ "GetIsPlayableRace", 254 },
-			{ "GetOffersServicesNow", 255 },
-			{ "HasAssociationType", 258 },
-			{ "HasFamilyRelationship", 259 },
-			{ "HasParentRelationship", 261 },
-			{ "IsWarningAbout", 262 },
-			{ "IsWeaponOut", 263 },
-			{ "HasSpell", 264 },
-			{ "IsTimePassing", 265 },
-			{ "IsPleasant", 266 },
-			{ "IsCloudy", 267 },
-			{ "IsSmallBump", 274 },
-			{ "GetBaseActorValue", 277 },
-			{ "IsOwner", 278 },
-			{ "IsCellOwner", 280 },
-			{ "IsHorseStolen", 282 },
-			{ "IsLeftUp", 285 },
-			{ "IsSneaking", 286 },
-			{ "IsRunning", 287 },
-			{ "GetFriendHit", 288 },
-			{ "IsInCombat", 289 },
-			{ "IsInInterior", 300 },
-			{ "IsWaterObject", 304 },
-			{ "GetPlayerAction", 305 },
-			{ "IsActorUsingATorch", 306 },
-			{ "IsXBox", 309 },
-			{ "GetInWorldspace", 310 },
-			{ "GetPCMiscStat", 312 },
-			{ "GetPairedAnimation", 313 },
-			{ "IsActorAVictim", 314 },
-			{ "GetTotalPersuasionNumber", 315 },
-			{ "GetIdleDoneOnce", 318 },
-			{ "GetNoRumors", 320 },
-			{ "GetCombatState", 323 },
-			{ "GetWithinPackageLocation", 325 },
-			{ "IsRidingMount", 327 },
-			{ "IsFleeing", 329 },
-			{ "IsInDangerousWater", 332 },
-			{ "GetIgnoreFriendlyHits", 338 },
-			{ "IsPlayersLastRiddenMount", 339 },
-			{ "IsActor", 353 },
-			{ "IsEssential", 354 },
-			{ "IsPlayerMovingIntoNewSpace", 358 },
-			{ "GetInCurrentLoc", 359 },
-			{ "GetInCurrentLocAlias", 360 },
-			{ "GetTimeDead", 361 },
-			{ "HasLinkedRef", 362 },
-			{ "IsChild", 365 },
-			{ "GetStolenItemValueNoCrime", 366 },
-			{ "GetLastPlayerAction", 367 },
-			{ "IsPlayerActionActive", 368 },
-			{ "IsTalkingActivatorActor", 370 },
-			{ "IsInList", 372 },
-			{ "GetStolenItemValue", 373 },
-			{ "GetCrimeGoldViolent", 375 },
-			{ "GetCrimeGoldNonviolent", 376 },
-			{ "HasShout", 378 },
-			{ "GetHasNote", 381 },
-			{ "GetHitLocation", 390 },
-			{ "IsPC1stPerson", 391 },
-			{ "GetCauseofDeath", 396 },
-			{ "IsLimbGone", 397 },
-			{ "IsWeaponInList", 398 },
-			{ "IsBribedbyPlayer", 402 },
-			{ "GetRelationshipRank", 403 },
-			{ "GetVATSValue", 407 },
-			{ "IsKiller", 408 },
-			{ "IsKillerObject", 409 },
-			{ "GetFactionCombatReaction", 410 },
-			{ "Exists", 414 },
-			{ "GetGroupMemberCount", 415 },
-			{ "GetGroupTargetCount", 416 },
-			{ "GetIsVoiceType", 426 },
-			{ "GetPlantedExplosive", 427 },
-			{ "IsScenePackageRunning", 429 },
-			{ "GetHealthPercentage", 430 },
-			{ "GetIsObjectType", 432 },
-			{ "GetDialogueEmotion", 434 },
-			{ "GetDialogueEmotionValue", 435 },
-			{ "GetIsCreatureType", 437 },
-			{ "GetInCurrentLocFormList", 444 },
-			{ "GetInZone", 445 },
-			{ "GetVelocity", 446 },
-			{ "GetGraphVariableFloat", 447 },
-			{ "HasPerk", 448 },
-			{ "GetFactionRelation", 449 },
-			{ "IsLastIdlePlayed", 450 },
-			{ "GetPlayerTeammate", 453 },
-			{ "GetPlayerTeammateCount", 454 },
-			{ "GetActorCrimePlayerEnemy", 458 },
-			{ "GetCrimeGold", 459 },
-			{ "IsPlayerGrabbedRef", 463 },
-			{ "GetKeywordItemCount", 465 },
-			{ "GetDestructionStage", 470 },
-			{ "GetIsAlignment", 473 },
-			{ "IsProtected", 476 },
-			{ "GetThreatRatio", 477 },
-			{ "GetIsUsedItemEquipType", 479 },
-			{ "IsCarryable", 487 },
-			{ "GetConcussed", 488 },
-			{ "GetMapMarkerVisible", 491 },
-			{ "PlayerKnows", 493 },
-			{ "GetPermanentActorValue", 494 },
-			{ "GetKillingBlowLimb", 495 },
-			{ "CanPayCrimeGold", 497 },
-			{ "GetDaysInJail", 499 },
-			{ "EPAlchemyGetMakingPoison", 500 },
-			{ "EPAlchemyEffectHasKeyword", 501 },
-			{ "GetAllowWorldInteractions", 503 },
-			{ "GetLastHitCritical", 508 },
-			{ "IsCombatTarget", 513 },
-			{ "GetVATSRightAreaFree", 515 },
-			{ "GetVATSLeftAreaFree", 516 },
-			{ "GetVATSBackAreaFree", 517 },
-			{ "GetVATSFrontAreaFree", 518 },
-			{ "GetLockIsBroken", 519 },
-			{ "IsPS3", 520 },
-			{ "IsWin32", 521 },
-			{ "GetVATSRightTargetVisible", 522 },
-			{ "GetVATSLeftTargetVisible", 523 },
-			{ "GetVATSBackTargetVisible", 524 },
-			{ "GetVATSFrontTargetVisible", 525 },
-			{ "IsInCriticalStage", 528 },
-			{ "GetXPForNextLevel", 530 },
-			{ "GetInfamy", 533 },
-			{ "GetInfamyViolent", 534 },
-			{ "GetInfamyNonViolent", 535 },
-			{ "GetQuestCompleted", 543 },
-			{ "IsGoreDisabled", 547 },
-			{ "IsSceneActionComplete", 550 },
-			{ "GetSpellUsageNum", 552 },
-			{ "GetActorsInHigh", 554 },
-			{ "HasLoaded3D", 555 },
-			{ "HasKeyword", 560 },
-			{ "HasRefType", 561 },
-			{ "LocationHasKeyword", 562 },
-			{ "LocationHasRefType", 563 },
-			{ "GetIsEditorLocation", 565 },
-			{ "GetIsAliasRef", 566 },
-			{ "GetIsEditorLocAlias", 567 },
-			{ "IsSprinting", 568 },
-			{ "IsBlocking", 569 },
-			{ "HasEquippedSpell", 570 },
-			{ "GetCurrentCastingType", 571 },
-			{ "GetCurrentDeliveryType", 572 },
-			{ "GetAttackState", 574 },
-			{ "GetEventData", 576 },
-			{ "IsCloserToAThanB", 577 },
-			{ "GetEquippedShout", 579 },
-			{ "IsBleedingOut", 580 },
-			{ "GetRelativeAngle", 584 },
-			{ "GetMovementDirection", 589 },
-			{ "IsInScene", 590 },
-			{ "GetRefTypeDeadCount", 591 },
-			{ "GetRefTypeAliveCount", 592 },
-			{ "GetIsFlying", 594 },
-			{ "IsCurrentSpell", 595 },
-			{ "SpellHasKeyword", 596 },
-			{ "GetEquippedItemType", 597 },
-			{ "GetLocationAliasCleared", 598 },
-			{ "GetLocAliasRefTypeDeadCount", 600 },
-			{ "GetLocAliasRefTypeAliveCount", 601 },
-			{ "IsWardState", 602 },
-			{ "IsInSameCurrentLocAsRef", 603 },
-			{ "IsInSameCurrentLocAsRefAlias", 604 },
-			{ "LocAliasIsLocation", 605 },
-			{ "GetKeywordDataForLocation", 606 },
-			{ "GetKeywordDataForAlias", 608 },
-			{ "LocAliasHasKeyword", 610 },
-			{ "IsNullPackageData", 611 },
-			{ "GetNumericPackageData", 612 },
-			{ "IsFurnitureAnimType", 613 },
-			{ "IsFurnitureEntryType", 614 },
-			{ "GetHighestRelationshipRank", 615 },
-			{ "GetLowestRelationshipRank", 616 },
-			{ "HasAssociationTypeAny", 617 },
-			{ "HasFamilyRelationshipAny", 618 },
-			{ "GetPathingTargetOffset", 619 },
-			{ "GetPathingTargetAngleOffset", 620 },
-			{ "GetPathingTargetSpeed", 621 },
-			{ "GetPathingTargetSpeedAngle", 622 },
-			{ "GetMovementSpeed", 623 },
-			{ "GetInContainer", 624 },
-			{ "IsLocationLoaded", 625 },
-			{ "IsLocAliasLoaded", 626 },
-			{ "IsDualCasting", 627 },
-			{ "GetVMQuestVariable", 629 },
-			{ "GetVMScriptVariable", 630 },
-			{ "IsEnteringInteractionQuick", 631 },
-			{ "IsCasting", 632 },
-			{ "GetFlyingState", 633 },
-			{ "IsInFavorState", 635 },
-			{ "HasTwoHandedWeaponEquipped", 636 },
-			{ "IsExitingInstant", 637 },
-			{ "IsInFriendStateWithPlayer", 638 },
-			{ "GetWithinDistance", 639 },
-			{ "GetActorValuePercent", 640 },
-			{ "IsUnique", 641 },
-			{ "GetLastBumpDirection", 642 },
-			{ "IsInFurnitureState", 644 },
-			{ "GetIsInjured", 645 },
-			{ "GetIsCrashLandRequest", 646 },
-			{ "GetIsHastyLandRequest", 647 },
-			{ "IsLinkedTo", 650 },
-			{ "GetKeywordDataForCurrentLocation", 651 },
-			{ "GetInSharedCrimeFaction", 652 },
-			{ "GetBribeSuccess", 654 },
-			{ "GetIntimidateSuccess", 655 },
-			{ "GetArrestedState", 656 },
-			{ "GetArrestingActor", 657 },
-			{ "EPTemperingItemIsEnchanted", 659 },
-			{ "EPTemperingItemHasKeyword", 660 },
-			{ "GetReplacedItemType", 664 },
-			{ "IsAttacking", 672 },
-			{ "IsPowerAttacking", 673 },
-			{ "IsLastHostileActor", 674 },
-			{ "GetGraphVariableInt", 675 },
-			{ "GetCurrentShoutVariation", 676 },
-			{ "ShouldAttackKill", 678 },
-			{ "GetActivatorHeight", 680 },
-			{ "EPMagic_IsAdvanceSkill", 681 },
-			{ "WornHasKeyword", 682 },
-			{ "GetPathingCurrentSpeed", 683 },
-			{ "GetPathingCurrentSpeedAngle", 684 },
-			{ "EPModSkillUsage_AdvanceObjectHasKeyword", 691 },
-			{ "EPModSkillUsage_IsAdvanceAction", 692 },
-			{ "EPMagic_SpellHasKeyword", 693 },
-			{ "GetNoBleedoutRecovery", 694 },
-			{ "EPMagic_SpellHasSkill", 696 },
-			{ "IsAttackType", 697 },
-			{ "IsAllowedToFly", 698 },
-			{ "HasMagicEffectKeyword", 699 },
-			{ "IsCommandedActor", 700 },
-			{ "IsStaggered", 701 },
-			{ "IsRecoiling", 702 },
-			{ "IsExitingInteractionQuick", 703 },
-			{ "IsPathing", 704 },
-			{ "GetShouldHelp", 705 },
-			{ "HasBoundWeaponEquipped", 706 },
-			{ "GetCombatTargetHasKeyword", 707 },
-			{ "GetCombatGroupMemberCount", 709 },
-			{ "IsIgnoringCombat", 710 },
-			{ "GetLightLevel", 711 },
-			{ "SpellHasCastingPerk", 713 },
-			{ "IsBeingRidden", 714 },
-			{ "IsUndead", 715 },
-			{ "GetRealHoursPassed", 716 },
-			{ "IsUnlockedDoor", 718 },
-			{ "IsHostileToActor", 719 },
-			{ "GetTargetHeight", 720 },
-			{ "IsPoison", 721 },
-			{ "WornApparelHasKeywordCount", 722 },
-			{ "GetItemHealthPercent", 723 },
-			{ "EffectWasDualCast", 724 },
-			{ "GetKnockedStateEnum", 725 },
-			{ "DoesNotExist", 726 },
-			{ "IsOnFlyingMount", 730 },
-			{ "CanFlyHere", 731 },
-			{ "IsFlyingMountPatrolQueud", 732 },
-			{ "IsFlyingMountFastTravelling", 733 },
-			{ "IsOverEncumbered", 734 },
-			{ "GetActorWarmth", 735 },
-			{ "GetSKSEVersion", 1024 },
-			{ "GetSKSEVersionMinor", 1025 },
-			{ "GetSKSEVersionBeta", 1026 },
-			{ "GetSKSERelease", 1027 },
-			{ "ClearInvalidRegistrations", 1028 }
+		struct FunctionInfo
+		{
+			std::uint32_t id;
+			std::string_view name;
+			std::optional<PARAM_TYPE> param1{};
+			std::optional<PARAM_TYPE> param2{};
 		};
 
+
+		// condition functions sorted by ID, the name maps and GetFuncType are generated from this
+		inline constexpr std::array<FunctionInfo, 402> functions{ {
+				{ 0, "GetWantBlocking" },
+				{ 1, "GetDistance", PARAM_TYPE::kObjectRef },
+				{ 5, "GetLocked" },
+				{ 6, "GetPos", PARAM_TYPE::kAxis },
+				{ 8, "GetAngle", PARAM_TYPE::kAxis },
+				{ 10, "GetStartingPos", PARAM_TYPE::kAxis },
+				{ 11, "GetStartingAngle", PARAM_TYPE::kAxis },
+				{ 12, "GetSecondsPassed" },
+				{ 14, "GetActorValue", PARAM_TYPE::kActorValue },
+				{ 18, "GetCurrentTime" },
+				{ 24, "GetScale" },
+				{ 25, "IsMoving" },
+				{ 26, "IsTurning" },
+				{ 27, "GetLineOfSight", PARAM_TYPE::kObjectRef },
+				{ 32, "GetInSameCell", PARAM_TYPE::kObjectRef },
+				{ 35, "GetDisabled" },
+				{ 36, "MenuMode", PARAM_TYPE::kInt },
+				{ 39, "GetDisease" },
+				{ 41, "GetClothingValue" },
+				{ 42, "SameFaction", PARAM_TYPE::kActor },
+				{ 43, "SameRace", PARAM_TYPE::kActor },
+				{ 44, "SameSex", PARAM_TYPE::kActor },
+				{ 45, "GetDetected", PARAM_TYPE::kActor },
+				{ 46, "GetDead" },
+				{ 47, "GetItemCount", PARAM_TYPE::kInvObjectOrFormList },
+				{ 48, "GetGold" },
+				{ 49, "GetSleeping" },
+				{ 50, "GetTalkedToPC" },
+				{ 53, "GetScriptVariable", PARAM_TYPE::kObjectRef, PARAM_TYPE::kChar },
+				{ 56, "GetQuestRunning", PARAM_TYPE::kQuest },
+				{ 58, "GetStage", PARAM_TYPE::kQuest },
+				{ 59, "GetStageDone", PARAM_TYPE::kQuest, PARAM_TYPE::kInt },
+				{ 60, "GetFactionRankDifference", PARAM_TYPE::kFaction, PARAM_TYPE::kActor },
+				{ 61, "GetAlarmed" },
+				{ 62, "IsRaining" },
+				{ 63, "GetAttacked" },
+				{ 64, "GetIsCreature" },
+				{ 65, "GetLockLevel" },
+				{ 66, "GetShouldAttack", PARAM_TYPE::kActor },
+				{ 67, "GetInCell", PARAM_TYPE::kCell },
+				{ 68, "GetIsClass", PARAM_TYPE::kClass },
+				{ 69, "GetIsRace", PARAM_TYPE::kRace },
+				{ 70, "GetIsSex", PARAM_TYPE::kSex },
+				{ 71, "GetInFaction", PARAM_TYPE::kFaction },
+				{ 72, "GetIsID", PARAM_TYPE::kObjectOrFormList },
+				{ 73, "GetFactionRank", PARAM_TYPE::kFaction },
+				{ 74, "GetGlobalValue", PARAM_TYPE::kGlobal },
+				{ 75, "IsSnowing" },
+				{ 77, "GetRandomPercent" },
+				{ 79, "GetQuestVariable", PARAM_TYPE::kQuest, PARAM_TYPE::kChar },
+				{ 80, "GetLevel" },
+				{ 81, "IsRotating" },
+				{ 84, "GetDeadCount", PARAM_TYPE::kActorBase },
+				{ 91, "GetIsAlerted" },
+				{ 98, "GetPlayerControlsDisabled", PARAM_TYPE::kInt, PARAM_TYPE::kInt },
+				{ 99, "GetHeadingAngle", PARAM_TYPE::kObjectRef },
+				{ 101, "IsWeaponMagicOut" },
+				{ 102, "IsTorchOut" },
+				{ 103, "IsShieldOut" },
+				{ 106, "IsFacingUp" },
+				{ 107, "GetKnockedState" },
+				{ 108, "GetWeaponAnimType" },
+				{ 109, "IsWeaponSkillType", PARAM_TYPE::kActorValue },
+				{ 110, "GetCurrentAIPackage" },
+				{ 111, "IsWaiting" },
+				{ 112, "IsIdlePlaying" },
+				{ 116, "IsIntimidatedbyPlayer" },
+				{ 117, "IsPlayerInRegion", PARAM_TYPE::kRegion },
+				{ 118, "GetActorAggroRadiusViolated" },
+				{ 122, "GetCrime", PARAM_TYPE::kActor, PARAM_TYPE::kCrimeType },
+				{ 123, "IsGreetingPlayer" },
+				{ 125, "IsGuard" },
+				{ 127, "HasBeenEaten" },
+				{ 128, "GetStaminaPercentage" },
+				{ 129, "GetPCIsClass", PARAM_TYPE::kClass },
+				{ 130, "GetPCIsRace", PARAM_TYPE::kRace },
+				{ 131, "GetPCIsSex", PARAM_TYPE::kSex },
+				{ 132, "GetPCInFaction", PARAM_TYPE::kFaction },
+				{ 133, "SameFactionAsPC" },
+				{ 134, "SameRaceAsPC" },
+				{ 135, "SameSexAsPC" },
+				{ 136, "GetIsReference", PARAM_TYPE::kObjectRef },
+				{ 141, "IsTalking" },
+				{ 142, "GetWalkSpeed" },
+				{ 143, "GetCurrentAIProcedure" },
+				{ 144, "GetTrespassWarningLevel" },
+				{ 145, "IsTrespassing" },
+				{ 146, "IsInMyOwnedCell" },
+				{ 147, "GetWindSpeed" },
+				{ 148, "GetCurrentWeatherPercent" },
+				{ 149, "GetIsCurrentWeather", PARAM_TYPE::kWeather },
+				{ 150, "IsContinuingPackagePCNear" },
+				{ 152, "GetIsCrimeFaction", PARAM_TYPE::kFaction },
+				{ 153, "CanHaveFlames" },
+				{ 154, "HasFlames" },
+				{ 157, "GetOpenState" },
+				{ 159, "GetSitting" },
+				{ 161, "GetIsCurrentPackage", PARAM_TYPE::kPackage },
+				{ 162, "IsCurrentFurnitureRef", PARAM_TYPE::kObjectRef },
+				{ 163, "IsCurrentFurnitureObj", PARAM_TYPE::kFurnitureOrFormList },
+				{ 170, "GetDayOfWeek" },
+				{ 172, "GetTalkedToPCParam", PARAM_TYPE::kActor },
+				{ 175, "IsPCSleeping" },
+				{ 176, "IsPCAMurderer" },
+				{ 180, "HasSameEditorLocAsRef", PARAM_TYPE::kObjectRef, PARAM_TYPE::kKeyword },
+				{ 181, "HasSameEditorLocAsRefAlias", PARAM_TYPE::kAlias, PARAM_TYPE::kKeyword },
+				{ 182, "GetEquipped", PARAM_TYPE::kInvObjectOrFormList },
+				{ 185, "IsSwimming" },
+				{ 190, "GetAmountSoldStolen" },
+				{ 192, "GetIgnoreCrime" },
+				{ 193, "GetPCExpelled", PARAM_TYPE::kFaction },
+				{ 195, "GetPCFactionMurder", PARAM_TYPE::kFaction },
+				{ 197, "GetPCEnemyofFaction", PARAM_TYPE::kFaction },
+				{ 199, "GetPCFactionAttack", PARAM_TYPE::kFaction },
+				{ 203, "GetDestroyed" },
+				{ 214, "HasMagicEffect", PARAM_TYPE::kMagicEffect },
+				{ 215, "GetDefaultOpen" },
+				{ 219, "GetAnimAction" },
+				{ 223, "IsSpellTarget", PARAM_TYPE::kMagicItem },
+				{ 224, "GetVATSMode" },
+				{ 225, "GetPersuasionNumber" },
+				{ 226, "GetVampireFeed" },
+				{ 227, "GetCannibal" },
+				{ 228, "GetIsClassDefault", PARAM_TYPE::kClass },
+				{ 229, "GetClassDefaultMatch" },
+				{ 230, "GetInCellParam", PARAM_TYPE::kCell, PARAM_TYPE::kObjectRef },
+				{ 235, "GetVatsTargetHeight" },
+				{ 237, "GetIsGhost" },
+				{ 242, "GetUnconscious" },
+				{ 244, "GetRestrained" },
+				{ 246, "GetIsUsedItem", PARAM_TYPE::kObjectOrFormList },
+				{ 247, "GetIsUsedItemType", PARAM_TYPE::kFormType },
+				{ 248, "IsScenePlaying", PARAM_TYPE::kBGSScene },
+				{ 249, "IsInDialogueWithPlayer" },
+				{ 250, "GetLocationCleared", PARAM_TYPE::kLocation },
+				{ 254, "GetIsPlayableRace" },
+				{ 255, "GetOffersServicesNow" },
+				{ 258, "HasAssociationType", PARAM_TYPE::kActor, PARAM_TYPE::kAssociationType },
+				{ 259, "HasFamilyRelationship", PARAM_TYPE::kActor },
+				{ 261, "HasParentRelationship", PARAM_TYPE::kActor },
+				{ 262, "IsWarningAbout", PARAM_TYPE::kFormList },
+				{ 263, "IsWeaponOut" },
+				{ 264, "HasSpell", PARAM_TYPE::kMagicItem },
+				{ 265, "IsTimePassing" },
+				{ 266, "IsPleasant" },
+				{ 267, "IsCloudy" },
+				{ 274, "IsSmallBump" },
+				{ 277, "GetBaseActorValue", PARAM_TYPE::kActorValue },
+				{ 278, "IsOwner", PARAM_TYPE::kOwner },
+				{ 280, "IsCellOwner", PARAM_TYPE::kCell, PARAM_TYPE::kOwner },
+				{ 282, "IsHorseStolen" },
+				{ 285, "IsLeftUp" },
+				{ 286, "IsSneaking" },
+				{ 287, "IsRunning" },
+				{ 288, "GetFriendHit" },
+				{ 289, "IsInCombat", PARAM_TYPE::kInt },
+				{ 300, "IsInInterior" },
+				{ 304, "IsWaterObject" },
+				{ 305, "GetPlayerAction" },
+				{ 306, "IsActorUsingATorch" },
+				{ 309, "IsXBox" },
+				{ 310, "GetInWorldspace", PARAM_TYPE::kWorldOrList },
+				{ 312, "GetPCMiscStat", PARAM_TYPE::kMiscStat },
+				{ 313, "GetPairedAnimation" },
+				{ 314, "IsActorAVictim" },
+				{ 315, "GetTotalPersuasionNumber" },
+				{ 318, "GetIdleDoneOnce" },
+				{ 320, "GetNoRumors" },
+				{ 323, "GetCombatState" },
+				{ 325, "GetWithinPackageLocation", PARAM_TYPE::kPackageDataCanBeNull },
+				{ 327, "IsRidingMount" },
+				{ 329, "IsFleeing" },
+				{ 332, "IsInDangerousWater" },
+				{ 338, "GetIgnoreFriendlyHits" },
+				{ 339, "IsPlayersLastRiddenMount" },
+				{ 353, "IsActor" },
+				{ 354, "IsEssential" },
+				{ 358, "IsPlayerMovingIntoNewSpace" },
+				{ 359, "GetInCurrentLoc", PARAM_TYPE::kLocation },
+				{ 360, "GetInCurrentLocAlias", PARAM_TYPE::kAlias },
+				{ 361, "GetTimeDead" },
+				{ 362, "HasLinkedRef", PARAM_TYPE::kKeyword },
+				{ 365, "IsChild" },
+				{ 366, "GetStolenItemValueNoCrime", PARAM_TYPE::kFaction },
+				{ 367, "GetLastPlayerAction" },
+				{ 368, "IsPlayerActionActive", PARAM_TYPE::kInt },
+				{ 370, "IsTalkingActivatorActor", PARAM_TYPE::kActor },
+				{ 372, "IsInList", PARAM_TYPE::kFormList },
+				{ 373, "GetStolenItemValue", PARAM_TYPE::kFaction },
+				{ 375, "GetCrimeGoldViolent" },
+				{ 376, "GetCrimeGoldNonviolent" },
+				{ 378, "HasShout", PARAM_TYPE::kShout },
+				{ 381, "GetHasNote", PARAM_TYPE::kInt },
+				{ 390, "GetHitLocation" },
+				{ 391, "IsPC1stPerson" },
+				{ 396, "GetCauseofDeath" },
+				{ 397, "IsLimbGone", PARAM_TYPE::kInt },
+				{ 398, "IsWeaponInList", PARAM_TYPE::kFormList },
+				{ 402, "IsBribedbyPlayer" },
+				{ 403, "GetRelationshipRank", PARAM_TYPE::kObjectRef },
+				{ 407, "GetVATSValue", PARAM_TYPE::kInt, PARAM_TYPE::kInt },
+				{ 408, "IsKiller", PARAM_TYPE::kActor },
+				{ 409, "IsKillerObject", PARAM_TYPE::kFormList },
+				{ 410, "GetFactionCombatReaction", PARAM_TYPE::kFaction, PARAM_TYPE::kFaction },
+				{ 414, "Exists", PARAM_TYPE::kObjectRef },
+				{ 415, "GetGroupMemberCount" },
+				{ 416, "GetGroupTargetCount" },
+				{ 426, "GetIsVoiceType", PARAM_TYPE::kVoiceType },
+				{ 427, "GetPlantedExplosive" },
+				{ 429, "IsScenePackageRunning" },
+				{ 430, "GetHealthPercentage" },
+				{ 432, "GetIsObjectType", PARAM_TYPE::kFormType },
+				{ 434, "GetDialogueEmotion" },
+				{ 435, "GetDialogueEmotionValue" },
+				{ 437, "GetIsCreatureType", PARAM_TYPE::kInt },
+				{ 444, "GetInCurrentLocFormList", PARAM_TYPE::kFormList },
+				{ 445, "GetInZone", PARAM_TYPE::kEncounterZone },
+				{ 446, "GetVelocity", PARAM_TYPE::kAxis },
+				{ 447, "GetGraphVariableFloat", PARAM_TYPE::kChar },
+				{ 448, "HasPerk", PARAM_TYPE::kPerk, PARAM_TYPE::kInt },
+				{ 449, "GetFactionRelation", PARAM_TYPE::kActor },
+				{ 450, "IsLastIdlePlayed", PARAM_TYPE::kIdleForm },
+				{ 453, "GetPlayerTeammate" },
+				{ 454, "GetPlayerTeammateCount" },
+				{ 458, "GetActorCrimePlayerEnemy" },
+				{ 459, "GetCrimeGold" },
+				{ 463, "IsPlayerGrabbedRef", PARAM_TYPE::kObjectRef },
+				{ 465, "GetKeywordItemCount", PARAM_TYPE::kKeyword },
+				{ 470, "GetDestructionStage" },
+				{ 473, "GetIsAlignment", PARAM_TYPE::kAlignment },
+				{ 476, "IsProtected" },
+				{ 477, "GetThreatRatio", PARAM_TYPE::kActor },
+				{ 479, "GetIsUsedItemEquipType", PARAM_TYPE::kEquipType },
+				{ 487, "IsCarryable" },
+				{ 488, "GetConcussed" },
+				{ 491, "GetMapMarkerVisible" },
+				{ 493, "PlayerKnows", PARAM_TYPE::kKnowableForm },
+				{ 494, "GetPermanentActorValue", PARAM_TYPE::kActorValue },
+				{ 495, "GetKillingBlowLimb" },
+				{ 497, "CanPayCrimeGold" },
+				{ 499, "GetDaysInJail" },
+				{ 500, "EPAlchemyGetMakingPoison" },
+				{ 501, "EPAlchemyEffectHasKeyword", PARAM_TYPE::kKeyword },
+				{ 503, "GetAllowWorldInteractions" },
+				{ 508, "GetLastHitCritical" },
+				{ 513, "IsCombatTarget", PARAM_TYPE::kActor },
+				{ 515, "GetVATSRightAreaFree", PARAM_TYPE::kObjectRef },
+				{ 516, "GetVATSLeftAreaFree", PARAM_TYPE::kObjectRef },
+				{ 517, "GetVATSBackAreaFree", PARAM_TYPE::kObjectRef },
+				{ 518, "GetVATSFrontAreaFree", PARAM_TYPE::kObjectRef },
+				{ 519, "GetLockIsBroken" },
+				{ 520, "IsPS3" },
+				{ 521, "IsWin32" },
+				{ 522, "GetVATSRightTargetVisible", PARAM_TYPE::kObjectRef },
+				{ 523, "GetVATSLeftTargetVisible", PARAM_TYPE::kObjectRef },
+				{ 524, "GetVATSBackTargetVisible", PARAM_TYPE::kObjectRef },
+				{ 525, "GetVATSFrontTargetVisible", PARAM_TYPE::kObjectRef },
+				{ 528, "IsInCriticalStage", PARAM_TYPE::kCritStage },
+				{ 530, "GetXPForNextLevel" },
+				{ 533, "GetInfamy" },
+				{ 534, "GetInfamyViolent" },
+				{ 535, "GetInfamyNonViolent" },
+				{ 543, "GetQuestCompleted", PARAM_TYPE::kQuest },
+				{ 547, "IsGoreDisabled" },
+				{ 550, "IsSceneActionComplete", PARAM_TYPE::kBGSScene, PARAM_TYPE::kInt },
+				{ 552, "GetSpellUsageNum", PARAM_TYPE::kMagicItem },
+				{ 554, "GetActorsInHigh" },
+				{ 555, "HasLoaded3D" },
+				{ 560, "HasKeyword", PARAM_TYPE::kKeyword },
+				{ 561, "HasRefType", PARAM_TYPE::kRefType },
+				{ 562, "LocationHasKeyword", PARAM_TYPE::kKeyword },
+				{ 563, "LocationHasRefType", PARAM_TYPE::kRefType },
+				{ 565, "GetIsEditorLocation", PARAM_TYPE::kLocation },
+				{ 566, "GetIsAliasRef", PARAM_TYPE::kAlias },
+				{ 567, "GetIsEditorLocAlias", PARAM_TYPE::kAlias },
+				{ 568, "IsSprinting" },
+				{ 569, "IsBlocking" },
+				{ 570, "HasEquippedSpell", PARAM_TYPE::kCastingSource },
+				{ 571, "GetCurrentCastingType", PARAM_TYPE::kCastingSource },
+				{ 572, "GetCurrentDeliveryType", PARAM_TYPE::kCastingSource },
+				{ 574, "GetAttackState" },
+				{ 576, "GetEventData", PARAM_TYPE::kEventFunction, PARAM_TYPE::kEventFunctionData },  // third parameter in xEdit but who cares, we're skipping this
+				{ 577, "IsCloserToAThanB", PARAM_TYPE::kObjectRef, PARAM_TYPE::kObjectRef },
+				{ 579, "GetEquippedShout", PARAM_TYPE::kShout },
+				{ 580, "IsBleedingOut" },
+				{ 584, "GetRelativeAngle", PARAM_TYPE::kObjectRef, PARAM_TYPE::kAxis },
+				{ 589, "GetMovementDirection" },
+				{ 590, "IsInScene" },
+				{ 591, "GetRefTypeDeadCount", PARAM_TYPE::kLocation, PARAM_TYPE::kRefType },
+				{ 592, "GetRefTypeAliveCount", PARAM_TYPE::kLocation, PARAM_TYPE::kRefType },
+				{ 594, "GetIsFlying" },
+				{ 595, "IsCurrentSpell", PARAM_TYPE::kMagicItem, PARAM_TYPE::kCastingSource },
+				{ 596, "SpellHasKeyword", PARAM_TYPE::kCastingSource, PARAM_TYPE::kKeyword },
+				{ 597, "GetEquippedItemType", PARAM_TYPE::kCastingSource },
+				{ 598, "GetLocationAliasCleared", PARAM_TYPE::kAlias },
+				{ 600, "GetLocAliasRefTypeDeadCount", PARAM_TYPE::kAlias, PARAM_TYPE::kRefType },
+				{ 601, "GetLocAliasRefTypeAliveCount", PARAM_TYPE::kAlias, PARAM_TYPE::kRefType },
+				{ 602, "IsWardState", PARAM_TYPE::kWardState },
+				{ 603, "IsInSameCurrentLocAsRef", PARAM_TYPE::kObjectRef, PARAM_TYPE::kKeyword },
+				{ 604, "IsInSameCurrentLocAsRefAlias", PARAM_TYPE::kAlias, PARAM_TYPE::kKeyword },
+				{ 605, "LocAliasIsLocation", PARAM_TYPE::kAlias, PARAM_TYPE::kLocation },
+				{ 606, "GetKeywordDataForLocation", PARAM_TYPE::kLocation, PARAM_TYPE::kKeyword },
+				{ 608, "GetKeywordDataForAlias", PARAM_TYPE::kAlias, PARAM_TYPE::kKeyword },
+				{ 610, "LocAliasHasKeyword", PARAM_TYPE::kAlias, PARAM_TYPE::kKeyword },
+				{ 611, "IsNullPackageData", PARAM_TYPE::kPackageDataCanBeNull },
+				{ 612, "GetNumericPackageData", PARAM_TYPE::kInt },
+				{ 613, "IsFurnitureAnimType", PARAM_TYPE::kFurnitureAnimType },
+				{ 614, "IsFurnitureEntryType", PARAM_TYPE::kFurnitureEntryType },
+				{ 615, "GetHighestRelationshipRank" },
+				{ 616, "GetLowestRelationshipRank" },
+				{ 617, "HasAssociationTypeAny", PARAM_TYPE::kAssociationType },
+				{ 618, "HasFamilyRelationshipAny" },
+				{ 619, "GetPathingTargetOffset", PARAM_TYPE::kAxis },
+				{ 620, "GetPathingTargetAngleOffset", PARAM_TYPE::kAxis },
+				{ 621, "GetPathingTargetSpeed" },
+				{ 622, "GetPathingTargetSpeedAngle", PARAM_TYPE::kAxis },
+				{ 623, "GetMovementSpeed" },
+				{ 624, "GetInContainer", PARAM_TYPE::kObjectRef },
+				{ 625, "IsLocationLoaded", PARAM_TYPE::kLocation },
+				{ 626, "IsLocAliasLoaded", PARAM_TYPE::kAlias },
+				{ 627, "IsDualCasting" },
+				{ 629, "GetVMQuestVariable", PARAM_TYPE::kQuest, PARAM_TYPE::kChar },
+				{ 630, "GetVMScriptVariable", PARAM_TYPE::kObjectRef, PARAM_TYPE::kChar },
+				{ 631, "IsEnteringInteractionQuick" },
+				{ 632, "IsCasting" },
+				{ 633, "GetFlyingState" },
+				{ 635, "IsInFavorState" },
+				{ 636, "HasTwoHandedWeaponEquipped" },
+				{ 637, "IsExitingInstant" },
+				{ 638, "IsInFriendStateWithPlayer" },
+				{ 639, "GetWithinDistance", PARAM_TYPE::kObjectRef, PARAM_TYPE::kFloat },
+				{ 640, "GetActorValuePercent", PARAM_TYPE::kActorValue },
+				{ 641, "IsUnique" },
+				{ 642, "GetLastBumpDirection" },
+				{ 644, "IsInFurnitureState", PARAM_TYPE::kFurnitureAnimType },
+				{ 645, "GetIsInjured" },
+				{ 646, "GetIsCrashLandRequest" },
+				{ 647, "GetIsHastyLandRequest" },
+				{ 650, "IsLinkedTo", PARAM_TYPE::kObjectRef, PARAM_TYPE::kKeyword },
+				{ 651, "GetKeywordDataForCurrentLocation", PARAM_TYPE::kKeyword },
+				{ 652, "GetInSharedCrimeFaction", PARAM_TYPE::kObjectRef },
+				{ 654, "GetBribeSuccess" },
+				{ 655, "GetIntimidateSuccess" },
+				{ 656, "GetArrestedState" },
+				{ 657, "GetArrestingActor" },
+				{ 659, "EPTemperingItemIsEnchanted" },
+				{ 660, "EPTemperingItemHasKeyword", PARAM_TYPE::kKeyword },
+				{ 664, "GetReplacedItemType", PARAM_TYPE::kCastingSource },
+				{ 672, "IsAttacking" },
+				{ 673, "IsPowerAttacking" },
+				{ 674, "IsLastHostileActor" },
+				{ 675, "GetGraphVariableInt", PARAM_TYPE::kChar },
+				{ 676, "GetCurrentShoutVariation" },
+				{ 678, "ShouldAttackKill", PARAM_TYPE::kActor },
+				{ 680, "GetActivatorHeight" },
+				{ 681, "EPMagic_IsAdvanceSkill", PARAM_TYPE::kActorValue },
+				{ 682, "WornHasKeyword", PARAM_TYPE::kKeyword },
+				{ 683, "GetPathingCurrentSpeed" },
+				{ 684, "GetPathingCurrentSpeedAngle", PARAM_TYPE::kAxis },
+				{ 691, "EPModSkillUsage_AdvanceObjectHasKeyword", PARAM_TYPE::kKeyword },
+				{ 692, "EPModSkillUsage_IsAdvanceAction", PARAM_TYPE::kSkillAction },
+				{ 693, "EPMagic_SpellHasKeyword", PARAM_TYPE::kKeyword },
+				{ 694, "GetNoBleedoutRecovery" },
+				{ 696, "EPMagic_SpellHasSkill", PARAM_TYPE::kActorValue },
+				{ 697, "IsAttackType", PARAM_TYPE::kKeyword },
+				{ 698, "IsAllowedToFly" },
+				{ 699, "HasMagicEffectKeyword", PARAM_TYPE::kKeyword },
+				{ 700, "IsCommandedActor" },
+				{ 701, "IsStaggered" },
+				{ 702, "IsRecoiling" },
+				{ 703, "IsExitingInteractionQuick" },
+				{ 704, "IsPathing" },
+				{ 705, "GetShouldHelp", PARAM_TYPE::kActor },
+				{ 706, "HasBoundWeaponEquipped", PARAM_TYPE::kCastingSource },
+				{ 707, "GetCombatTargetHasKeyword", PARAM_TYPE::kKeyword },
+				{ 709, "GetCombatGroupMemberCount" },
+				{ 710, "IsIgnoringCombat" },
+				{ 711, "GetLightLevel" },
+				{ 713, "SpellHasCastingPerk", PARAM_TYPE::kPerk },
+				{ 714, "IsBeingRidden" },
+				{ 715, "IsUndead" },
+				{ 716, "GetRealHoursPassed" },
+				{ 718, "IsUnlockedDoor" },
+				{ 719, "IsHostileToActor", PARAM_TYPE::kActor },
+				{ 720, "GetTargetHeight", PARAM_TYPE::kObjectRef },
+				{ 721, "IsPoison" },
+				{ 722, "WornApparelHasKeywordCount", PARAM_TYPE::kKeyword },
+				{ 723, "GetItemHealthPercent" },
+				{ 724, "EffectWasDualCast" },
+				{ 725, "GetKnockedStateEnum" },
+				{ 726, "DoesNotExist" },
+				{ 730, "IsOnFlyingMount" },
+				{ 731, "CanFlyHere" },
+				{ 732, "IsFlyingMountPatrolQueud" },
+				{ 733, "IsFlyingMountFastTravelling" },
+				{ 734, "IsOverEncumbered" },
+				{ 735, "GetActorWarmth" },
+				{ 1024, "GetSKSEVersion" },
+				{ 1025, "GetSKSEVersionMinor" },
+				{ 1026, "GetSKSEVersionBeta" },
+				{ 1027, "GetSKSERelease" },
+				{ 1028, "ClearInvalidRegistrations" }
+		} };
+
+
+		namespace detail
+		{
+			template <std::size_t... I>
+			constexpr auto MakeFuncIDPairs(std::index_sequence<I...>)
+			{
+				return std::array<std::pair<std::uint32_t, frozen::string>, sizeof...(I)>{ { { functions[I].id, frozen::string(functions[I].name.data(), functions[I].name.size()) }... } };
+			}
+
+
+			template <std::size_t... I>
+			constexpr auto MakeFuncIDReversePairs(std::index_sequence<I...>)
+			{
+				return std::array<std::pair<frozen::string, std::uint32_t>, sizeof...(I)>{ { { frozen::string(functions[I].name.data(), functions[I].name.size()), functions[I].id }... } };
+			}
+
+
+			inline constexpr std::uint16_t INVALID_INDEX = 0xFFFF;
+
+
+			constexpr auto MakeFuncIndex()
+			{
+				std::array<std::uint16_t, functions.back().id + 1> index{};
+				for (auto& value : index) {
+					value = INVALID_INDEX;
+				}
+				for (std::size_t i = 0; i < functions.size(); i++) {
+					index[functions[i].id] = static_cast<std::uint16_t>(i);
+				}
+				return index;
+			}
+		}
+
+
+		inline constexpr auto funcID = frozen::make_map(detail::MakeFuncIDPairs(std::make_index_sequence<functions.size()>()));
+		inline constexpr auto funcID_reverse = frozen::make_map(detail::MakeFuncIDReversePairs(std::make_index_sequence<functions.size()>()));
+
+		// function ID -> index into functions
+		inline constexpr auto funcIndex = detail::MakeFuncIndex();
+
+
+		namespace detail
+		{
+			constexpr bool IsFunctionTableValid()
+			{
+				for (std::size_t i = 0; i < functions.size(); i++) {
+					const auto& function = functions[i];
+					if (i > 0 && functions[i - 1].id >= function.id) {
+						return false;
+					}
+					if (function.name.empty() || (!function.param1 && function.param2)) {
+						return false;
+					}
+					//a duplicate name would resolve to another ID
+					const auto it = funcID_reverse.find(frozen::string(function.name.data(), function.name.size()));
+					if (it == funcID_reverse.end() || it->second != function.id) {
+						return false;
+					}
+				}
+				return true;
+			}
+		}
+
+		static_assert(detail::IsFunctionTableValid(), "condition functions must have unique IDs and names, sorted by ID");
+		static_assert(funcID.size() == functions.size() && funcID_reverse.size() == functions.size());
+
 		inline constexpr frozen::map<std::uint32_t, frozen::string, 8> conditionObj = {
 			{ 0, "Subject" },
 			{ 1, "Target" },
@@ -886,16 +558,51 @@ namespace Condition
 	};
 
 
-	inline auto isStringValid(const std::string& a_str) -> bool
+	enum class STATUS : std::uint32_t
+	{
+		kOK = 0,
+		kMissingField,
+		kInvalidValue,
+		kUnsupportedValue
+	};
+
+
+	struct ParseResult
+	{
+		STATUS status;
+		TYPE field;
+	};
+
+
+	inline auto isStringValid(std::string_view a_str) -> bool
+	{
+		return !a_str.empty() && a_str.find("NONE"sv) == std::string_view::npos && a_str.find_first_not_of(" \t\n\r\f\v"sv) != std::string_view::npos;
+	}
+
+
+	// parameter types of a_funcID, none for unknown functions
+	constexpr auto GetFuncType(FUNC_ID a_funcID) -> PARAMS
 	{
-		return !a_str.empty() && a_str.find("NONE"sv) == std::string::npos && !STRING::onlySpace(a_str);
+		const auto id = static_cast<std::uint32_t>(a_funcID);
+		if (id >= MAP::funcIndex.size() || MAP::funcIndex[id] == MAP::detail::INVALID_INDEX) {
+			return { std::nullopt, std::nullopt };
+		}
+
+		const auto& function = MAP::functions[MAP::funcIndex[id]];
+		return { function.param1, function.param2 };
 	}
 
+
 	using ConditionData = std::tuple<OBJECT, FUNC_ID, void*, void*, OP_CODE, float, bool>;
 	using ConditionDataVec = std::vector<ConditionData>;
 
 	auto GetCondition(RE::TESForm& a_form, std::uint32_t a_index) -> RE::TESCondition*;
 
+	// parses one parameter field, forms are written as "0x800 ~ MyMod.esp"
+	auto ParseVoidParams(std::string_view a_str, void*& a_param, std::optional<PARAM_TYPE> a_type) -> bool;
+
+	// parses "OBJECT | FUNCTION | PARAM1 | PARAM2 | OPCODE | FLOAT | AND/OR" without allocating or throwing
+	auto ParseCondition(std::string_view a_condition, ConditionData& a_data) -> ParseResult;
 	auto ParseConditions(const std::vector<RE::BSFixedString>& a_conditionList) -> ConditionDataVec;
-	auto BuildConditions(RE::TESCondition* a_conditions) -> std::vector<RE::BSFixedString>;
+	auto BuildConditions(const RE::TESCondition* a_conditions) -> std::vector<RE::BSFixedString>;
 }
@@ -0,0 +1,53 @@
+#pragma once
+
+
+namespace Condition
+{
+	// optional evaluation counts and timings, per condition function and per evaluated form
+	// disabled by default, the evaluator only checks a flag until it is turned on
+	class Profiler
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+
+		struct Stats
+		{
+			std::uint64_t evaluations{ 0 };
+			std::uint64_t cached{ 0 };
+			Clock::duration time{ 0 };
+		};
+
+
+		static Profiler* GetSingleton();
+
+		// enabling starts over from empty stats
+		void SetEnabled(bool a_enable);
+		bool IsEnabled() const;
+
+		void RecordFunction(std::uint32_t a_functionID, Clock::duration a_time);
+		void RecordCachedFunction(std::uint32_t a_functionID);
+		void RecordForm(const RE::TESForm* a_form, Clock::duration a_time);
+
+		// functions, then forms, each ranked by total time
+		std::vector<std::string> GetReport() const;
+		void LogReport() const;
+
+	private:
+		using Lock = std::mutex;
+		using Locker = std::lock_guard<Lock>;
+
+		Profiler() = default;
+		Profiler(const Profiler&) = delete;
+		Profiler(Profiler&&) = delete;
+		~Profiler() = default;
+
+		Profiler& operator=(const Profiler&) = delete;
+		Profiler& operator=(Profiler&&) = delete;
+
+		std::atomic<bool> _enabled{ false };
+		std::unordered_map<std::uint32_t, Stats> _functions;
+		std::unordered_map<RE::FormID, Stats> _forms;
+		mutable Lock _lock;
+	};
+}
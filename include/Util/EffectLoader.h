@@ -0,0 +1,12 @@
+#pragma once
+
+
+// adds conditioned magic effects to spells and enchantments from Data/SKSE/Plugins/*_PEFX.ini, once data is loaded
+//
+// one effect per line, fields separated by commas :
+// Effect = MagicItem, MagicEffect, magnitude, area, duration, cost, condition, condition...
+// forms are written as in condition lists ("0x800 ~ MyMod.esp"), ';' starts a comment
+namespace EffectLoader
+{
+	void Load();
+}
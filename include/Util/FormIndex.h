@@ -0,0 +1,285 @@
+#pragma once
+
+
+namespace FormIndex
+{
+	// keyword -> bitset over TESDataHandler::GetFormArray<T>(), for the form types the GetAll* natives query
+	// built on the first query, after keyword distributors have run at data load, and kept current by keyword edits made here
+	class Keywords
+	{
+	public:
+		static Keywords* GetSingleton();
+
+		// forms with any of the keywords, in form array order
+		// nullopt if T isn't indexed or its form array has changed size since the index was built
+		template <class T>
+		std::optional<std::vector<T*>> GetForms(const std::vector<RE::BGSKeyword*>& a_keywords);
+		std::optional<std::vector<RE::TESForm*>> GetForms(RE::FormType a_formType, const std::vector<RE::BGSKeyword*>& a_keywords);
+
+		// call after every keyword edit, it also drops the query results and the actor snapshot built from keywords
+		void Update(const RE::TESForm* a_form, const RE::BGSKeyword* a_keyword, bool a_add);
+
+	private:
+		using Lock = std::mutex;
+		using Locker = std::lock_guard<Lock>;
+		using Bitset = std::vector<std::uint64_t>;
+
+
+		struct Table
+		{
+			std::vector<RE::TESForm*> forms;
+			std::unordered_map<RE::FormID, std::uint32_t> positions;
+			std::unordered_map<RE::FormID, Bitset> keywords;
+		};
+
+
+		static constexpr std::size_t kNone = static_cast<std::size_t>(-1);
+		static constexpr std::array<RE::FormType, 3> TYPES{ RE::FormType::Spell, RE::FormType::Race, RE::FormType::Enchantment };
+
+
+		Keywords() = default;
+		Keywords(const Keywords&) = delete;
+		Keywords(Keywords&&) = delete;
+		~Keywords() = default;
+
+		Keywords& operator=(const Keywords&) = delete;
+		Keywords& operator=(Keywords&&) = delete;
+
+		static std::size_t GetSlot(RE::FormType a_formType);
+
+		// caller holds _lock
+		void Build();
+		template <class T>
+		void BuildTable(Table& a_table, const RE::BSTArray<T*>& a_forms);
+		std::size_t GetMatches(std::size_t a_slot, std::size_t a_size, const std::vector<RE::BGSKeyword*>& a_keywords, std::vector<RE::TESForm*>& a_matches);
+
+		std::array<Table, TYPES.size()> _tables;
+		bool _built{ false };
+		Lock _lock;
+	};
+
+
+	namespace detail
+	{
+		template <class T>
+		std::optional<std::vector<T*>> Cast(std::optional<std::vector<RE::TESForm*>>&& a_forms)
+		{
+			if (!a_forms) {
+				return std::nullopt;
+			}
+
+			std::vector<T*> forms;
+			forms.reserve(a_forms->size());
+			for (const auto& form : *a_forms) {
+				forms.push_back(static_cast<T*>(form));
+			}
+			return forms;
+		}
+	}
+
+
+	template <class T>
+	std::optional<std::vector<T*>> Keywords::GetForms(const std::vector<RE::BGSKeyword*>& a_keywords)
+	{
+		return detail::Cast<T>(GetForms(T::FORMTYPE, a_keywords));
+	}
+
+
+	// plugin name -> file, and file -> the forms it defines, for the form types the GetAll*InMod natives query
+	// built once at data load; the forms a plugin defines don't change afterwards, so lookups don't lock
+	class Plugins
+	{
+	public:
+		static Plugins* GetSingleton();
+
+		void Build();
+
+		// case insensitive, like TESDataHandler::LookupModByName, which it falls back to before the index is built
+		const RE::TESFile* LookupMod(std::string_view a_name) const;
+
+		// forms whose ID belongs to the file, in form array order
+		// nullopt if T isn't indexed or the index isn't built yet
+		template <class T>
+		std::optional<std::vector<T*>> GetForms(const RE::TESFile* a_file) const;
+		std::optional<std::vector<RE::TESForm*>> GetForms(RE::FormType a_formType, const RE::TESFile* a_file) const;
+
+	private:
+		static constexpr std::size_t kNone = static_cast<std::size_t>(-1);
+		static constexpr std::array<RE::FormType, 4> TYPES{ RE::FormType::Spell, RE::FormType::Race, RE::FormType::Enchantment, RE::FormType::Book };
+
+
+		using FormLists = std::array<std::vector<RE::TESForm*>, TYPES.size()>;
+
+
+		Plugins() = default;
+		Plugins(const Plugins&) = delete;
+		Plugins(Plugins&&) = delete;
+		~Plugins() = default;
+
+		Plugins& operator=(const Plugins&) = delete;
+		Plugins& operator=(Plugins&&) = delete;
+
+		static std::size_t GetSlot(RE::FormType a_formType);
+
+		std::unordered_map<std::string, const RE::TESFile*> _names;
+		std::unordered_map<const RE::TESFile*, FormLists> _forms;
+		bool _built{ false };
+	};
+
+
+	template <class T>
+	std::optional<std::vector<T*>> Plugins::GetForms(const RE::TESFile* a_file) const
+	{
+		return detail::Cast<T>(GetForms(T::FORMTYPE, a_file));
+	}
+
+
+	// kTeachesSpell books : book -> spell, spell -> books, and tomes by the plugin that added the book
+	// built once at data load, before any script can query it
+	class SpellTomes
+	{
+	public:
+		struct Tome
+		{
+			RE::TESObjectBOOK* book;
+			RE::SpellItem* spell;
+		};
+
+
+		static SpellTomes* GetSingleton();
+
+		void Build();
+
+		// in book form array order
+		const std::vector<Tome>& GetTomes() const;
+		const std::vector<Tome>& GetTomes(const RE::TESFile* a_file) const;
+
+		// the first tome that teaches the spell, or nullptr if it can't be learned from a book
+		RE::TESObjectBOOK* GetTome(const RE::SpellItem* a_spell) const;
+
+	private:
+		SpellTomes() = default;
+		SpellTomes(const SpellTomes&) = delete;
+		SpellTomes(SpellTomes&&) = delete;
+		~SpellTomes() = default;
+
+		SpellTomes& operator=(const SpellTomes&) = delete;
+		SpellTomes& operator=(SpellTomes&&) = delete;
+
+		std::vector<Tome> _tomes;
+		std::unordered_map<const RE::SpellItem*, std::vector<RE::TESObjectBOOK*>> _books;
+		std::unordered_map<const RE::TESFile*, std::vector<Tome>> _plugins;
+		bool _built{ false };
+	};
+
+
+	// results of the GetAll* natives, keyed by their arguments
+	// dropped when a keyword is edited through this plugin, on game load, or when a form array they read changes as runtime forms are added
+	class Results
+	{
+	public:
+		enum class QUERY : std::uint32_t
+		{
+			kGetAll,
+			kGetAllInMod,
+			kGetAllOfType
+		};
+
+
+		struct Key
+		{
+			QUERY query;
+			RE::FormType formType;
+			std::vector<RE::FormID> any;
+			std::vector<RE::FormID> all;
+			const RE::TESFile* modInfo;
+			bool playable;
+
+			bool operator<(const Key& a_rhs) const
+			{
+				return std::tie(query, formType, any, all, modInfo, playable) < std::tie(a_rhs.query, a_rhs.formType, a_rhs.any, a_rhs.all, a_rhs.modInfo, a_rhs.playable);
+			}
+		};
+
+
+		static Results* GetSingleton();
+
+		// keyword order doesn't change the result, so keyword sets are sorted
+		static Key MakeKey(QUERY a_query, RE::FormType a_formType, const std::vector<RE::BGSKeyword*>& a_any, const std::vector<RE::BGSKeyword*>& a_all, const RE::TESFile* a_modInfo, bool a_playable);
+
+		// returns the cached result, or runs the query and caches it
+		template <class T, class F>
+		std::vector<T*> Get(const Key& a_key, F&& a_query);
+
+		void Invalidate();
+
+		// cached queries, estimated heap size
+		std::pair<std::size_t, std::size_t> GetMemoryUsage() const;
+
+	private:
+		using Lock = std::mutex;
+		using Locker = std::lock_guard<Lock>;
+
+		static constexpr std::size_t MAX_ENTRIES = 128;  //queries kept before the cache starts over
+		static constexpr std::size_t MAX_FORMS = 4096;   //larger results are rescanned on each call
+
+
+		// a form array's size and last form, so a form replaced at the end is caught as well as an added one
+		struct Stamp
+		{
+			bool operator==(const Stamp& a_rhs) const { return size == a_rhs.size && last == a_rhs.last; }
+			bool operator!=(const Stamp& a_rhs) const { return !(*this == a_rhs); }
+
+			std::size_t size;
+			const RE::TESForm* last;
+		};
+
+
+		struct Entry
+		{
+			std::vector<RE::TESForm*> forms;
+			Stamp formArray;
+			Stamp books;  //playable spells are read from spell tomes
+		};
+
+
+		Results() = default;
+		Results(const Results&) = delete;
+		Results(Results&&) = delete;
+		~Results() = default;
+
+		Results& operator=(const Results&) = delete;
+		Results& operator=(Results&&) = delete;
+
+		// form arrays the result will be checked against, taken before the query runs
+		static Entry GetStamps(RE::FormType a_formType);
+
+		std::optional<std::vector<RE::TESForm*>> Find(const Key& a_key);
+		void Insert(const Key& a_key, Entry a_entry, std::uint64_t a_generation);
+
+		std::map<Key, Entry> _results;
+		std::atomic<std::uint64_t> _generation{ 0 };
+		mutable Lock _lock;
+	};
+
+
+	template <class T, class F>
+	std::vector<T*> Results::Get(const Key& a_key, F&& a_query)
+	{
+		if (auto forms = detail::Cast<T>(Find(a_key)); forms) {
+			return *std::move(forms);
+		}
+
+		//an edit made while the query runs would leave its result stale
+		const auto generation = _generation.load();
+		auto entry = GetStamps(a_key.formType);
+
+		std::vector<T*> result = a_query();
+		if (result.size() <= MAX_FORMS) {
+			entry.forms.assign(result.begin(), result.end());
+			Insert(a_key, std::move(entry), generation);
+		}
+
+		return result;
+	}
+}
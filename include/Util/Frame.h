@@ -0,0 +1,11 @@
+#pragma once
+
+
+namespace Frame
+{
+	// frames counted from the player's per-frame update, for caches that only hold within one frame
+	// the count stands still while the game is paused in menus
+	std::uint64_t GetIndex();
+
+	void Install();
+}
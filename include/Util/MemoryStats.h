@@ -0,0 +1,110 @@
+#pragma once
+
+
+namespace MemoryStats
+{
+	enum class TYPE : std::uint32_t
+	{
+		kKeywords,
+		kPerks,
+		kRegistrations,
+		kQueuedEvents,
+		kExtraData,
+		kConditions,
+		kFormQueries,
+
+		kTotal
+	};
+
+
+	struct Entry
+	{
+		std::string_view name;
+		std::uint64_t allocs;
+		std::uint64_t frees;
+		std::uint64_t count;
+		std::uint64_t bytes;
+	};
+
+
+	// std::set/std::map node : left, parent, right, color, isnil (padded)
+	inline constexpr std::size_t TREE_NODE_OVERHEAD = 3 * sizeof(void*) + 8;
+
+
+	template <class T>
+	std::size_t GetCount(const T& a_value);
+	template <class T>
+	std::size_t GetCount(const std::set<T>& a_set);
+	template <class K, class V>
+	std::size_t GetCount(const std::map<K, V>& a_map);
+
+	template <class T>
+	std::size_t GetHeapSize(const T& a_value);
+	template <class T>
+	std::size_t GetHeapSize(const std::set<T>& a_set);
+	template <class K, class V>
+	std::size_t GetHeapSize(const std::map<K, V>& a_map);
+
+
+	template <class T>
+	std::size_t GetCount(const T&)
+	{
+		return 1;
+	}
+
+	template <class T>
+	std::size_t GetCount(const std::set<T>& a_set)
+	{
+		return a_set.size();
+	}
+
+	template <class K, class V>
+	std::size_t GetCount(const std::map<K, V>& a_map)
+	{
+		std::size_t count = 0;
+		for (const auto& [key, value] : a_map) {
+			count += GetCount(value);
+		}
+		return count;
+	}
+
+
+	template <class T>
+	std::size_t GetHeapSize(const T&)
+	{
+		return 0;
+	}
+
+	template <class T>
+	std::size_t GetHeapSize(const std::set<T>& a_set)
+	{
+		std::size_t size = TREE_NODE_OVERHEAD;  //head node
+		for (const auto& value : a_set) {
+			size += TREE_NODE_OVERHEAD + sizeof(T) + GetHeapSize(value);
+		}
+		return size;
+	}
+
+	template <class K, class V>
+	std::size_t GetHeapSize(const std::map<K, V>& a_map)
+	{
+		std::size_t size = TREE_NODE_OVERHEAD;
+		for (const auto& [key, value] : a_map) {
+			size += TREE_NODE_OVERHEAD + sizeof(std::pair<const K, V>) + GetHeapSize(value);
+		}
+		return size;
+	}
+
+
+	void Alloc(TYPE a_type, std::size_t a_size);
+
+	void Free(TYPE a_type, std::size_t a_size);
+
+	// a_scanReferences walks every loaded reference for extra data, leave it off on hot paths
+	std::vector<Entry> GetStats(bool a_scanReferences);
+
+	std::vector<std::string> GetReport(bool a_scanReferences);
+
+	// counters only, cheap enough to log on save
+	void LogReport();
+}
@@ -0,0 +1,266 @@
+#pragma once
+
+
+namespace Spatial
+{
+	// items filed into square columns of the XY plane, so a radius query only visits the columns the circle overlaps
+	// items are filed by the position they were inserted at, callers test the exact distance
+	template <class T>
+	class Grid
+	{
+	public:
+		using Key = std::uint64_t;
+
+
+		explicit Grid(float a_columnSize) :
+			_columnSize(a_columnSize)
+		{}
+
+
+		Key GetKey(const RE::NiPoint3& a_pos) const
+		{
+			return MakeKey(GetColumn(a_pos.x), GetColumn(a_pos.y));
+		}
+
+
+		void Insert(Key a_key, const T& a_item)
+		{
+			_columns[a_key].push_back(a_item);
+			_size++;
+		}
+
+
+		bool Erase(Key a_key, const T& a_item)
+		{
+			const auto it = _columns.find(a_key);
+			if (it == _columns.end()) {
+				return false;
+			}
+
+			auto& items = it->second;
+			const auto item = std::find(items.begin(), items.end(), a_item);
+			if (item == items.end()) {
+				return false;
+			}
+
+			*item = items.back();
+			items.pop_back();
+			if (items.empty()) {
+				_columns.erase(it);
+			}
+			_size--;
+
+			return true;
+		}
+
+
+		// a_func returns false to stop
+		template <class F>
+		void ForEachInRange(const RE::NiPoint3& a_origin, float a_radius, F&& a_func) const
+		{
+			const auto minX = GetColumn(a_origin.x - a_radius);
+			const auto maxX = GetColumn(a_origin.x + a_radius);
+			const auto minY = GetColumn(a_origin.y - a_radius);
+			const auto maxY = GetColumn(a_origin.y + a_radius);
+
+			for (auto x = minX; x <= maxX; x++) {
+				for (auto y = minY; y <= maxY; y++) {
+					const auto it = _columns.find(MakeKey(x, y));
+					if (it == _columns.end()) {
+						continue;
+					}
+					for (const auto& item : it->second) {
+						if (!a_func(item)) {
+							return;
+						}
+					}
+				}
+			}
+		}
+
+
+		void Clear()
+		{
+			_columns.clear();
+			_size = 0;
+		}
+
+
+		std::size_t size() const { return _size; }
+
+		std::size_t GetNumColumns() const { return _columns.size(); }
+
+	private:
+		std::int32_t GetColumn(float a_coord) const
+		{
+			return static_cast<std::int32_t>(std::floor(a_coord / _columnSize));
+		}
+
+
+		static Key MakeKey(std::int32_t a_x, std::int32_t a_y)
+		{
+			return (static_cast<Key>(static_cast<std::uint32_t>(a_x)) << 32) | static_cast<std::uint32_t>(a_y);
+		}
+
+
+		std::unordered_map<Key, std::vector<T>> _columns;
+		float _columnSize;
+		std::size_t _size{ 0 };
+	};
+
+
+	// actor positions as parallel arrays, padded to a multiple of four so distances are computed four at a time
+	// read only once finished, so one set can be queried from several threads
+	class ActorPositions
+	{
+	public:
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+
+		void Add(RE::Actor* a_actor);
+
+		// pads the arrays for the kernel, once every actor is added
+		void Finish();
+
+		std::size_t size() const { return _actors.size(); }
+		bool empty() const { return _actors.empty(); }
+
+		RE::Actor* GetActor(std::size_t a_index) const { return _actors[a_index]; }
+		const std::vector<RE::Actor*>& GetActors() const { return _actors; }
+
+		// squared distance from a_origin to each actor, in actor order, in a buffer owned by the calling thread
+		const float* GetSquaredDistances(const RE::NiPoint3& a_origin) const;
+
+		// the queries below skip a_exclude, and the player if a_ignorePlayer
+
+		// the nearest actor, or npos
+		std::size_t GetNearest(const RE::NiPoint3& a_origin, const RE::TESObjectREFR* a_exclude, bool a_ignorePlayer) const;
+
+		// up to a_count nearest actors within a_radius, nearest first. a radius of 0 is unlimited
+		void GetNearest(const RE::NiPoint3& a_origin, const RE::TESObjectREFR* a_exclude, bool a_ignorePlayer, std::size_t a_count, float a_radius, std::vector<RE::Actor*>& a_actors) const;
+
+		// actors within a_radius, in actor order
+		void GetInRange(const RE::NiPoint3& a_origin, const RE::TESObjectREFR* a_exclude, bool a_ignorePlayer, float a_radius, std::vector<RE::Actor*>& a_actors) const;
+
+	private:
+		bool IsSkipped(std::size_t a_index, const RE::TESObjectREFR* a_exclude, bool a_ignorePlayer) const;
+
+		std::vector<RE::Actor*> _actors;
+		std::vector<float> _x;
+		std::vector<float> _y;
+		std::vector<float> _z;
+	};
+
+
+	// references in attached cells, kept current from cell attach/detach, move attach/detach and 3D load events
+	// only references that can't move are filed in the grid : statics, trees and flora that aren't persistent or created at runtime.
+	// activators, lights, furniture and the like get moved by scripts (TranslateTo, SetPosition) without any event,
+	// so they're tested on every query with everything else
+	class ReferenceGrid :
+		public RE::BSTEventSink<RE::TESCellAttachDetachEvent>,
+		public RE::BSTEventSink<RE::TESMoveAttachDetachEvent>,
+		public RE::BSTEventSink<RE::TESObjectLoadedEvent>
+	{
+	public:
+		using EventResult = RE::BSEventNotifyControl;
+
+
+		static ReferenceGrid* GetSingleton();
+
+		void Register();
+
+		// same references as TES::ForEachReferenceInRange, in no particular order
+		// a radius of 0 visits every reference in the attached cells, through TES
+		void ForEachReferenceInRange(RE::TESObjectREFR* a_origin, float a_radius, std::function<bool(RE::TESObjectREFR&)> a_callback);
+
+		// before a save loads, as its cells attach again afterwards
+		void Clear();
+
+		EventResult ProcessEvent(const RE::TESCellAttachDetachEvent* a_event, RE::BSTEventSource<RE::TESCellAttachDetachEvent>*) override;
+		EventResult ProcessEvent(const RE::TESMoveAttachDetachEvent* a_event, RE::BSTEventSource<RE::TESMoveAttachDetachEvent>*) override;
+		EventResult ProcessEvent(const RE::TESObjectLoadedEvent* a_event, RE::BSTEventSource<RE::TESObjectLoadedEvent>*) override;
+
+	private:
+		using Lock = std::mutex;
+		using Locker = std::lock_guard<Lock>;
+
+		static constexpr float COLUMN_SIZE = 1024.0f;
+		static constexpr RE::FormID PLAYER = 0x14;
+
+
+		ReferenceGrid() = default;
+		ReferenceGrid(const ReferenceGrid&) = delete;
+		ReferenceGrid(ReferenceGrid&&) = delete;
+		~ReferenceGrid() = default;
+
+		ReferenceGrid& operator=(const ReferenceGrid&) = delete;
+		ReferenceGrid& operator=(ReferenceGrid&&) = delete;
+
+		static bool IsFixed(const RE::TESObjectREFR* a_ref);
+
+		// caller holds _lock
+		void Add(RE::TESObjectREFR* a_ref);
+		void Remove(RE::FormID a_formID);
+
+		Grid<RE::FormID> _grid{ COLUMN_SIZE };
+		std::unordered_map<RE::FormID, Grid<RE::FormID>::Key> _fixed;
+		std::unordered_set<RE::FormID> _dynamic;
+		std::atomic<bool> _registered{ false };
+		Lock _lock;
+	};
+
+
+	// navmesh vertices filed in a grid per navmesh, on the first query that needs them
+	// dropped when their cell detaches, and filed again if the cell is queried after it reattaches
+	class NavmeshGrid : public RE::BSTEventSink<RE::TESCellAttachDetachEvent>
+	{
+	public:
+		using EventResult = RE::BSEventNotifyControl;
+
+
+		static NavmeshGrid* GetSingleton();
+
+		void Register();
+
+		// nearest vertex of the cell's navmeshes within a_radius. a radius of 0 is unlimited
+		std::optional<RE::NiPoint3> GetNearestVertex(RE::TESObjectCELL* a_cell, const RE::NiPoint3& a_origin, float a_radius);
+
+		// before a save loads, as its cells attach again afterwards
+		void Clear();
+
+		EventResult ProcessEvent(const RE::TESCellAttachDetachEvent* a_event, RE::BSTEventSource<RE::TESCellAttachDetachEvent>*) override;
+
+	private:
+		using Lock = std::mutex;
+		using Locker = std::lock_guard<Lock>;
+
+		static constexpr float COLUMN_SIZE = 256.0f;
+
+
+		struct Vertices
+		{
+			Grid<RE::NiPoint3> grid{ COLUMN_SIZE };
+			RE::NiPoint3 min;  //xy bounds
+			RE::NiPoint3 max;
+		};
+
+
+		NavmeshGrid() = default;
+		NavmeshGrid(const NavmeshGrid&) = delete;
+		NavmeshGrid(NavmeshGrid&&) = delete;
+		~NavmeshGrid() = default;
+
+		NavmeshGrid& operator=(const NavmeshGrid&) = delete;
+		NavmeshGrid& operator=(NavmeshGrid&&) = delete;
+
+		// searches rings of columns outwards until the nearest vertex closer than a_squaredDistance is known
+		static void FindNearest(const Vertices& a_vertices, const RE::NiPoint3& a_origin, float& a_squaredDistance, std::optional<RE::NiPoint3>& a_nearest);
+
+		// caller holds _lock
+		const Vertices& GetVertices(const RE::TESObjectCELL* a_cell, const RE::NavMesh* a_navMesh);
+
+		std::unordered_map<RE::FormID, Vertices> _navMeshes;
+		std::unordered_map<RE::FormID, std::vector<RE::FormID>> _cells;
+		Lock _lock;
+	};
+}
@@ -1,5 +1,6 @@
 #include "Hooks/EventHook.h"
 
+#include "Serialization/ConditionalEvents.h"
 #include "Serialization/Events.h"
 
 
@@ -7,6 +8,8 @@ namespace Hook
 {
 	using namespace Serialization::HookedEvents;
 
+	namespace ConditionalEvents = Serialization::ConditionalEvents;
+
 	class ActorResurrect
 	{
 	public:
@@ -180,6 +183,7 @@ namespace Hook
 
 			if (target && baseEffect) {
 				OnMagicEffectApplyRegMap::GetSingleton()->QueueEvent(target, baseEffect, a_data->caster, baseEffect, a_data->magicItem, result);
+				ConditionalEvents::OnMagicEffectApplyRegMap::GetSingleton()->QueueEvent(target, a_data->caster, target, baseEffect, a_data->caster, baseEffect, a_data->magicItem, result);
 			}
 
 			return result;
@@ -1,5 +1,7 @@
 #include "Papyrus/Array.h"
 
+#include "Util/ActorSnapshot.h"
+
 
 auto papyrusArray::AddActorToArray(VM*, StackID, RE::StaticFunctionTag*, RE::Actor* a_actor, reference_array<RE::Actor*> a_actors) -> bool
 {
@@ -53,22 +55,19 @@ auto papyrusArray::GetSortedActorNameArray(VM*, StackID, RE::StaticFunctionTag*,
 	bool noKeyword = !a_keyword;
 	bool hasKeyword = false;
 
-	if (auto processLists = RE::ProcessLists::GetSingleton(); processLists) {
-		for (const auto& handle : processLists->highActorHandles) {
-			auto actorPtr = handle.get();
-			auto actor = actorPtr.get();
-			if (actor) {
-				if (!noKeyword) {
-					hasKeyword = actor->HasKeyword(a_keyword);
-					if (a_invert) {
-						hasKeyword = !hasKeyword;
-					}
-				}
-				if (noKeyword || hasKeyword) {
-					++nameMap[actor->GetName()];
-				}
+	const auto snapshot = Actors::Snapshot::Get();
+	const auto numHigh = snapshot->GetActors(Actors::Snapshot::kHigh).size();
+
+	for (std::size_t i = 0; i < numHigh; i++) {
+		if (!noKeyword) {
+			hasKeyword = snapshot->MayHaveKeyword(i, a_keyword) && snapshot->GetPositions().GetActor(i)->HasKeyword(a_keyword);
+			if (a_invert) {
+				hasKeyword = !hasKeyword;
 			}
 		}
+		if (noKeyword || hasKeyword) {
+			++nameMap[snapshot->GetName(i)];
+		}
 	}
 
 	std::vector<RE::BSFixedString> names;
@@ -1,23 +1,21 @@
 #include "Papyrus/Debug.h"
 
+#include "Util/FormIndex.h"
+
 
 void papyrusDebug::GivePlayerSpellBook(RE::StaticFunctionTag*)
 {
 	auto player = RE::PlayerCharacter::GetSingleton();
-	auto dataHandler = RE::TESDataHandler::GetSingleton();
-
-	if (player && dataHandler) {
-		for (const auto& book : dataHandler->GetFormArray<RE::TESObjectBOOK>()) {
-			if (book && book->data.flags.all(RE::OBJ_BOOK::Flag::kTeachesSpell)) {
-				auto spell = book->data.teaches.spell;
-				if (spell && !spell->fullName.empty()) {
-					auto mod = spell->GetDescriptionOwnerFile();
-					if (mod) {
-						auto modName = "[" + std::string(mod->fileName).substr(0, 4) + "] ";
-						spell->fullName = modName + spell->fullName.c_str();
-					}
-					player->AddSpell(spell);
+
+	if (player) {
+		for (const auto& [book, spell] : FormIndex::SpellTomes::GetSingleton()->GetTomes()) {
+			if (!spell->fullName.empty()) {
+				auto mod = spell->GetDescriptionOwnerFile();
+				if (mod) {
+					auto modName = "[" + std::string(mod->fileName).substr(0, 4) + "] ";
+					spell->fullName = modName + spell->fullName.c_str();
 				}
+				player->AddSpell(spell);
 			}
 		}
 	}
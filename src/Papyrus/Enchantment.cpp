@@ -1,6 +1,6 @@
 #include "Papyrus/Enchantment.h"
 
-#include "Util/ConditionParser.h"
+#include "Util/ConditionCache.h"
 
 
 void papyrusEnchantment::AddMagicEffectToEnchantment(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::EnchantmentItem* a_enchantment, RE::EffectSetting* a_mgef, float a_mag, std::uint32_t a_area, std::uint32_t a_dur, float a_cost, std::vector<RE::BSFixedString> a_conditionList)
@@ -33,28 +33,10 @@ void papyrusEnchantment::AddMagicEffectToEnchantment(VM* a_vm, StackID a_stackID
 			effect->cost = a_cost;
 
 			if (!a_conditionList.empty() && !a_conditionList.front().empty()) {
-				auto conditions = Condition::ParseConditions(a_conditionList);
-				if (!conditions.empty()) {
-					for (auto& [object, functionID, param1, param2, opCode, value, ANDOR] : conditions) {
-						auto newNode = new RE::TESConditionItem;
-						if (newNode) {
-							newNode->next = nullptr;
-							newNode->data.object = object;
-							newNode->data.functionData.function = functionID;
-							newNode->data.functionData.params[0] = param1;
-							newNode->data.functionData.params[1] = param2;
-							newNode->data.flags.opCode = opCode;
-							newNode->data.comparisonValue.f = value;
-							newNode->data.flags.isOR = ANDOR;
-
-							if (effect->conditions.head == nullptr) {
-								effect->conditions.head = newNode;
-							} else {
-								newNode->next = effect->conditions.head;
-								effect->conditions.head = newNode;
-							}
-						}
-					}
+				const auto chain = Condition::Cache::GetSingleton()->CreateChain(a_conditionList);
+				if (chain) {
+					effect->conditions.head = chain;
+					Condition::Cache::GetSingleton()->Invalidate(&effect->conditions);
 				} else {
 					a_vm->TraceStack("Failed to parse condition list", a_stackID, Severity::kInfo);
 				}
@@ -109,32 +91,8 @@ void papyrusEnchantment::AddEffectItemToEnchantment(VM* a_vm, StackID a_stackID,
 			effect->effectItem.duration = copyEffect->effectItem.duration;
 			effect->baseEffect = copyEffect->baseEffect;
 			effect->cost = a_cost == -1.0f ? copyEffect->cost : a_cost;
-			effect->conditions = copyEffect->conditions;
-
-			auto head = copyEffect->conditions.head;
-			while (head) {
-				auto newNode = new RE::TESConditionItem;
-				if (newNode) {
-					newNode->next = nullptr;
-					newNode->data.comparisonValue = head->data.comparisonValue;
-					newNode->data.runOnRef = head->data.runOnRef;
-					newNode->data.object = head->data.object;
-					newNode->data.dataID = head->data.dataID;
-					newNode->data.functionData.function = head->data.functionData.function;
-					newNode->data.functionData.params[0] = head->data.functionData.params[0];
-					newNode->data.functionData.params[1] = head->data.functionData.params[1];
-					newNode->data.flags = head->data.flags;
-					newNode->data.object = head->data.object;
-
-					if (effect->conditions.head == nullptr) {
-						effect->conditions.head = newNode;
-					} else {
-						newNode->next = effect->conditions.head;
-						effect->conditions.head = newNode;
-					}
-				}
-				head = head->next;
-			}
+			effect->conditions.head = Condition::Cache::CopyChain(copyEffect->conditions.head);
+			Condition::Cache::GetSingleton()->Invalidate(&effect->conditions);
 			a_enchantment->effects.push_back(effect);
 		}
 	}
@@ -1,7 +1,11 @@
 #include "Papyrus/Form.h"
 
+#include "Papyrus/EventBindings.h"
+
 #include "Serialization/Form/Keywords.h"
-#include "Util/ConditionParser.h"
+#include "Util/ConditionCache.h"
+#include "Util/ConditionEvaluator.h"
+#include "Util/FormIndex.h"
 
 
 void papyrusForm::AddKeywordToForm(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESForm* a_form, RE::BGSKeyword* a_add)
@@ -34,53 +38,67 @@ auto papyrusForm::EvaluateConditionList(VM* a_vm, StackID a_stackID, RE::StaticF
 		return false;
 	}
 
-	bool result = false;
+	return Condition::IsTrue(*a_form, a_actionRef, a_target);
+}
 
-	switch (a_form->GetFormType()) {
-	case RE::FormType::Spell:
-	case RE::FormType::Enchantment:
-	case RE::FormType::Ingredient:
-	case RE::FormType::AlchemyItem:
-	case RE::FormType::Scroll:
-		{
-			auto magicItem = a_form->As<RE::MagicItem>();
-			if (magicItem) {
-				for (auto& effect : magicItem->effects) {
-					if (result) {
-						break;
-					}
-					
-					if (effect) {
-						bool effectValid = false;
-						bool mgefValid = false;
-						
-						effectValid = effect->conditions.IsTrue(a_actionRef, a_target);
-						
-						auto baseEffect = effect->baseEffect;
-						mgefValid = baseEffect && baseEffect->conditions.IsTrue(a_actionRef, a_target);
-						
-						if (effectValid && mgefValid) {
-							result = true;
-						}
-					}
-				}
+
+auto papyrusForm::EvaluateConditionListBatch(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESForm* a_form, RE::TESObjectREFR* a_actionRef, std::vector<RE::TESObjectREFR*> a_targets) -> std::vector<std::int32_t>
+{
+	std::vector<std::int32_t> vec;
+
+	if (!a_form) {
+		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
+		return vec;
+	}
+	if (!a_actionRef) {
+		a_vm->TraceStack("Source is None", a_stackID, Severity::kWarning);
+		return vec;
+	}
+
+	Condition::Memo memo;
+
+	vec.reserve(a_targets.size());
+	for (const auto& target : a_targets) {
+		vec.push_back(target && Condition::IsTrue(*a_form, a_actionRef, target, &memo));
+	}
+
+	return vec;
+}
+
+
+auto papyrusForm::GetActorsMatchingConditionList(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESForm* a_form, RE::TESObjectREFR* a_actionRef, bool a_ignorePlayer) -> std::vector<RE::Actor*>
+{
+	std::vector<RE::Actor*> vec;
+
+	if (!a_form) {
+		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
+		return vec;
+	}
+	if (!a_actionRef) {
+		a_vm->TraceStack("Source is None", a_stackID, Severity::kWarning);
+		return vec;
+	}
+
+	Condition::Memo memo;
+
+	if (auto processLists = RE::ProcessLists::GetSingleton(); processLists) {
+		for (auto& actorHandle : processLists->highActorHandles) {
+			auto actorPtr = actorHandle.get();
+			auto actor = actorPtr.get();
+			if (actor && Condition::IsTrue(*a_form, a_actionRef, actor, &memo)) {
+				vec.push_back(actor);
 			}
 		}
-		break;
-	case RE::FormType::MagicEffect:
-		{
-			auto effect = a_form->As<RE::EffectSetting>();
-			if (effect && effect->conditions.IsTrue(a_actionRef, a_target)) {
-				result = true;
-			}
+	}
+
+	if (!a_ignorePlayer) {
+		auto player = RE::PlayerCharacter::GetSingleton();
+		if (player && Condition::IsTrue(*a_form, a_actionRef, player, &memo)) {
+			vec.push_back(player);
 		}
-		break;
-	default:
-		result = true;
-		break;
 	}
 
-	return result;
+	return vec;
 }
 
 
@@ -98,7 +116,7 @@ auto papyrusForm::GetConditionList(VM* a_vm, StackID a_stackID, RE::StaticFuncti
 		return a_vec;
 	}
 
-	return Condition::BuildConditions(condition);
+	return Condition::Cache::GetSingleton()->GetConditionList(condition);
 }
 
 
@@ -162,24 +180,16 @@ void papyrusForm::ReplaceKeywordOnForm(VM* a_vm, StackID a_stackID, RE::StaticFu
 			}
 			if (found) {
 				keywordForm->keywords[removeIndex] = a_add;
+
+				const auto index = FormIndex::Keywords::GetSingleton();
+				index->Update(a_form, a_remove, false);
+				index->Update(a_form, a_add, true);
 			}
 		}
 	}
 }
 
 
-void papyrusForm::RegisterForActorKilled(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnActorKillRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
 void papyrusForm::RegisterForFECReset(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form, std::uint32_t a_type)
 {
 	if (!a_form) {
@@ -228,102 +238,6 @@ void papyrusForm::RegisterForActorResurrected(VM* a_vm, StackID a_stackID, RE::S
 }
 
 
-void papyrusForm::RegisterForBookRead(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnBooksReadRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::RegisterForCellFullyLoaded(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = ScriptEvents::OnCellFullyLoadedRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::RegisterForCriticalHit(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnCriticalHitRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::RegisterForDisarmed(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnDisarmedRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::RegisterForDragonSoulGained(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnDragonSoulsGainedRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::RegisterForItemHarvested(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnItemHarvestedRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::RegisterForLevelIncrease(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnLevelIncreaseRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::RegisterForLocationDiscovery(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnLocationDiscoveryRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
 void papyrusForm::RegisterForObjectGrab(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
 {
 	if (!a_form) {
@@ -391,77 +305,6 @@ void papyrusForm::RegisterForQuestStage(VM* a_vm, StackID a_stackID, RE::StaticF
 }
 
 
-void papyrusForm::RegisterForShoutAttack(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnShoutAttackRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::RegisterForSkillIncrease(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnSkillIncreaseRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::RegisterForSoulTrapped(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnSoulsTrappedRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-void papyrusForm::RegisterForSpellLearned(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnSpellsLearnedRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::RegisterForWeatherChange(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = HookedEvents::OnWeatherChangeRegSet::GetSingleton();
-	regs->Register(a_form);
-}
-
-
-void papyrusForm::UnregisterForActorKilled(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnActorKillRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
 void papyrusForm::UnregisterForFECReset(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form, std::uint32_t a_type)
 {
 	if (!a_form) {
@@ -522,102 +365,6 @@ void papyrusForm::UnregisterForActorResurrected(VM* a_vm, StackID a_stackID, RE:
 }
 
 
-void papyrusForm::UnregisterForBookRead(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnBooksReadRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForCellFullyLoaded(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = ScriptEvents::OnCellFullyLoadedRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForCriticalHit(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnCriticalHitRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForDisarmed(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnDisarmedRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForDragonSoulGained(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnDragonSoulsGainedRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForItemHarvested(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnItemHarvestedRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForLevelIncrease(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnLevelIncreaseRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForLocationDiscovery(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnLocationDiscoveryRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
 void papyrusForm::UnregisterForObjectGrab(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
 {
 	if (!a_form) {
@@ -679,7 +426,7 @@ void papyrusForm::UnregisterForQuest(VM* a_vm, StackID a_stackID, RE::StaticFunc
 	auto start = ScriptEvents::OnQuestStartRegMap::GetSingleton();
 	start->Unregister(a_form, a_quest->GetFormID());
 
-	auto stop = ScriptEvents::OnQuestStartRegMap::GetSingleton();
+	auto stop = ScriptEvents::OnQuestStopRegMap::GetSingleton();
 	stop->Unregister(a_form, a_quest->GetFormID());
 }
 
@@ -694,7 +441,7 @@ void papyrusForm::UnregisterForAllQuests(VM* a_vm, StackID a_stackID, RE::Static
 	auto start = ScriptEvents::OnQuestStartRegMap::GetSingleton();
 	start->UnregisterAll(a_form);
 
-	auto stop = ScriptEvents::OnQuestStartRegMap::GetSingleton();
+	auto stop = ScriptEvents::OnQuestStopRegMap::GetSingleton();
 	stop->UnregisterAll(a_form);
 }
 
@@ -727,63 +474,15 @@ void papyrusForm::UnregisterForAllQuestStages(VM* a_vm, StackID a_stackID, RE::S
 }
 
 
-void papyrusForm::UnregisterForShoutAttack(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnShoutAttackRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForSkillIncrease(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnShoutAttackRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForSoulTrapped(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = StoryEvents::OnSoulsTrappedRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForSpellLearned(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
+void papyrusForm::UnregisterForAllPapyrusExtenderEvents(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
 {
 	if (!a_form) {
 		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
 		return;
 	}
 
-	auto regs = StoryEvents::OnSpellsLearnedRegSet::GetSingleton();
-	regs->Unregister(a_form);
-}
-
-
-void papyrusForm::UnregisterForWeatherChange(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, const RE::TESForm* a_form)
-{
-	if (!a_form) {
-		a_vm->TraceStack("Form is None", a_stackID, Severity::kWarning);
-		return;
-	}
-
-	auto regs = HookedEvents::OnWeatherChangeRegSet::GetSingleton();
-	regs->Unregister(a_form);
+	UnregisterForAllEvents(a_form);
+	UnregisterForAllConditionalEvents(a_form);
 }
 
 
@@ -801,6 +500,10 @@ auto papyrusForm::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("EvaluateConditionList"sv, Functions, EvaluateConditionList);
 
+	a_vm->RegisterFunction("EvaluateConditionListBatch"sv, Functions, EvaluateConditionListBatch);
+
+	a_vm->RegisterFunction("GetActorsMatchingConditionList"sv, Functions, GetActorsMatchingConditionList);
+
 	a_vm->RegisterFunction("GetConditionList"sv, Functions, GetConditionList);
 
 	a_vm->RegisterFunction("IsGeneratedForm"sv, Functions, IsGeneratedForm, true);
@@ -810,8 +513,6 @@ auto papyrusForm::RegisterFuncs(VM* a_vm) -> bool
 	a_vm->RegisterFunction("ReplaceKeywordOnForm"sv, Functions, ReplaceKeywordOnForm);
 
 
-	a_vm->RegisterFunction("RegisterForActorKilled"sv, Event_Form, RegisterForActorKilled, true);
-
 	a_vm->RegisterFunction("RegisterForFECReset"sv, Event_Form, RegisterForFECReset, true);
 
 	a_vm->RegisterFunction("RegisterForActorReanimateStart"sv, Event_Form, RegisterForActorReanimateStart, true);
@@ -820,22 +521,6 @@ auto papyrusForm::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("RegisterForActorResurrected"sv, Event_Form, RegisterForActorResurrected, true);
 
-	a_vm->RegisterFunction("RegisterForBookRead"sv, Event_Form, RegisterForBookRead, true);
-
-	a_vm->RegisterFunction("RegisterForCellFullyLoaded"sv, Event_Form, RegisterForCellFullyLoaded, true);
-
-	a_vm->RegisterFunction("RegisterForCriticalHit"sv, Event_Form, RegisterForCriticalHit, true);
-
-	a_vm->RegisterFunction("RegisterForDisarmed"sv, Event_Form, RegisterForDisarmed, true);
-
-	a_vm->RegisterFunction("RegisterForDragonSoulGained"sv, Event_Form, RegisterForDragonSoulGained, true);
-
-	a_vm->RegisterFunction("RegisterForItemHarvested"sv, Event_Form, RegisterForItemHarvested, true);
-
-	a_vm->RegisterFunction("RegisterForLevelIncrease"sv, Event_Form, RegisterForLevelIncrease, true);
-
-	a_vm->RegisterFunction("RegisterForLocationDiscovery"sv, Event_Form, RegisterForLocationDiscovery, true);
-
 	a_vm->RegisterFunction("RegisterForObjectGrab"sv, Event_Form, RegisterForObjectGrab, true);
 
 	a_vm->RegisterFunction("RegisterForObjectLoaded"sv, Event_Form, RegisterForObjectLoaded, true);
@@ -844,18 +529,6 @@ auto papyrusForm::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("RegisterForQuestStage"sv, Event_Form, RegisterForQuestStage, true);
 
-	a_vm->RegisterFunction("RegisterForShoutAttack"sv, Event_Form, RegisterForShoutAttack, true);
-
-	a_vm->RegisterFunction("RegisterForSkillIncrease"sv, Event_Form, RegisterForSkillIncrease, true);
-
-	a_vm->RegisterFunction("RegisterForSoulTrapped"sv, Event_Form, RegisterForSoulTrapped, true);
-
-	a_vm->RegisterFunction("RegisterForSpellLearned"sv, Event_Form, RegisterForSpellLearned, true);
-
-	a_vm->RegisterFunction("RegisterForWeatherChange"sv, Event_Form, RegisterForWeatherChange, true);
-
-
-	a_vm->RegisterFunction("UnregisterForActorKilled"sv, Event_Form, UnregisterForActorKilled, true);
 
 	a_vm->RegisterFunction("UnregisterForFECReset"sv, Event_Form, UnregisterForFECReset, true);
 
@@ -867,22 +540,6 @@ auto papyrusForm::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("UnregisterForActorResurrected"sv, Event_Form, UnregisterForActorResurrected, true);
 
-	a_vm->RegisterFunction("UnregisterForBookRead"sv, Event_Form, UnregisterForBookRead, true);
-
-	a_vm->RegisterFunction("UnregisterForCellFullyLoaded"sv, Event_Form, UnregisterForCellFullyLoaded, true);
-
-	a_vm->RegisterFunction("UnregisterForCriticalHit"sv, Event_Form, UnregisterForCriticalHit, true);
-
-	a_vm->RegisterFunction("UnregisterForDisarmed"sv, Event_Form, UnregisterForDisarmed, true);
-
-	a_vm->RegisterFunction("UnregisterForDragonSoulGained"sv, Event_Form, UnregisterForDragonSoulGained, true);
-
-	a_vm->RegisterFunction("UnregisterForItemHarvested"sv, Event_Form, UnregisterForItemHarvested, true);
-
-	a_vm->RegisterFunction("UnregisterForLevelIncrease"sv, Event_Form, UnregisterForLevelIncrease, true);
-
-	a_vm->RegisterFunction("UnregisterForLocationDiscovery"sv, Event_Form, UnregisterForLocationDiscovery, true);
-
 	a_vm->RegisterFunction("UnregisterForObjectGrab"sv, Event_Form, UnregisterForObjectGrab, true);
 
 	a_vm->RegisterFunction("UnregisterForObjectLoaded"sv, Event_Form, UnregisterForObjectLoaded, true);
@@ -897,15 +554,30 @@ auto papyrusForm::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("UnregisterForAllQuestStages"sv, Event_Form, UnregisterForAllQuestStages, true);
 
-	a_vm->RegisterFunction("UnregisterForShoutAttack"sv, Event_Form, UnregisterForShoutAttack, true);
-
-	a_vm->RegisterFunction("UnregisterForSkillIncrease"sv, Event_Form, UnregisterForSkillIncrease, true);
-
-	a_vm->RegisterFunction("UnregisterForSoulTrapped"sv, Event_Form, UnregisterForSoulTrapped, true);
-
-	a_vm->RegisterFunction("UnregisterForSpellLearned"sv, Event_Form, UnregisterForSpellLearned, true);
-
-	a_vm->RegisterFunction("UnregisterForWeatherChange"sv, Event_Form, UnregisterForWeatherChange, true);
+	a_vm->RegisterFunction("UnregisterForAllPapyrusExtenderEvents"sv, Event_Form, UnregisterForAllPapyrusExtenderEvents, true);
+
+
+	EventBindings::Bind<EventBindings::Form,
+		EVENT::kCellFullyLoaded,
+		EVENT::kActorKill,
+		EVENT::kBookRead,
+		EVENT::kCritHit,
+		EVENT::kDisarm,
+		EVENT::kDragonSoul,
+		EVENT::kHarvest,
+		EVENT::kLevelIncrease,
+		EVENT::kLocDiscovery,
+		EVENT::kShoutAttack,
+		EVENT::kSkillIncrease,
+		EVENT::kSoulTrap,
+		EVENT::kSpellLearned,
+		EVENT::kWeatherChange>(a_vm, Event_Form);
+
+	EventBindings::BindConditional<EventBindings::Form,
+		EVENT::kActorKill,
+		EVENT::kSoulTrap>(a_vm, Event_Form);
+
+	EventBindings::BindFiltered<EventBindings::Form, EVENT::kSkillIncreaseEx, std::uint32_t>(a_vm, Event_Form);
 
 	return true;
 }
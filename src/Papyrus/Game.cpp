@@ -1,83 +1,160 @@
 #include "Papyrus/Game.h"
+#include "Serialization/Telemetry.h"
+#include "Util/ActorSnapshot.h"
+#include "Util/ConditionProfiler.h"
+#include "Util/MemoryStats.h"
 #include "Version.h"
 
 
 auto papyrusGame::GetActorsByProcessingLevel(VM*, StackID, RE::StaticFunctionTag*, std::int32_t a_level) -> std::vector<RE::Actor*>
 {
+	if (a_level < 0 || a_level >= Actors::Snapshot::kTotal) {
+		return {};
+	}
+
+	const auto snapshot = Actors::Snapshot::Get();
+	const auto& actors = snapshot->GetActors(static_cast<Actors::Snapshot::LEVEL>(a_level));
+
 	std::vector<RE::Actor*> vec;
+	vec.reserve(actors.size());
+	for (const auto& actor : actors) {
+		vec.push_back(actor.get());
+	}
+
+	return vec;
+}
+
+
+auto papyrusGame::GetAllEnchantments(VM*, StackID, RE::StaticFunctionTag*, std::vector<RE::BGSKeyword*> a_keywords) -> std::vector<RE::EnchantmentItem*>
+{
+	const auto key = FormIndex::Results::MakeKey(FormIndex::Results::QUERY::kGetAll, RE::FormType::Enchantment, a_keywords, {}, nullptr, false);
+	return FormIndex::Results::GetSingleton()->Get<RE::EnchantmentItem>(key, [&]() {
+		std::vector<RE::EnchantmentItem*> vec;
+		GetAllForms<RE::EnchantmentItem>(vec, a_keywords);
+		return vec;
+	});
+}
+
 
-	if (auto processLists = RE::ProcessLists::GetSingleton(); processLists) {
-		RE::BSTArray<RE::ActorHandle>* arr = nullptr;
-
-		switch (a_level) {
-		case 0:
-			arr = &processLists->highActorHandles;
-			break;
-		case 1:
-			arr = &processLists->middleHighActorHandles;
-			break;
-		case 2:
-			arr = &processLists->middleLowActorHandles;
-			break;
-		case 3:
-			arr = &processLists->lowActorHandles;
-			break;
-		default:
-			break;
+void papyrusGame::QueryForms(RE::FormType a_formType, const FormFilter& a_filter, std::vector<RE::TESForm*>& a_vec)
+{
+	const auto dataHandler = RE::TESDataHandler::GetSingleton();
+	if (!dataHandler) {
+		return;
+	}
+
+	//start from the smallest index that applies, and skip the filter it already covers
+	std::optional<std::vector<RE::TESForm*>> candidates;
+	bool inMod = false;
+	bool hasAny = false;
+	if (a_filter.modInfo) {
+		candidates = FormIndex::Plugins::GetSingleton()->GetForms(a_formType, a_filter.modInfo);
+		inMod = candidates.has_value();
+	}
+	if (!candidates && !a_filter.any.empty()) {
+		candidates = FormIndex::Keywords::GetSingleton()->GetForms(a_formType, a_filter.any);
+		hasAny = candidates.has_value();
+	}
+
+	//spells are playable if a spell tome teaches them, as in GetAllSpells
+	const auto spellTomes = FormIndex::SpellTomes::GetSingleton();
+	const bool isSpell = a_formType == RE::FormType::Spell;
+
+	const auto matches = [&](const RE::TESForm* a_form) {
+		if (a_filter.modInfo && !inMod && !a_filter.modInfo->IsFormInMod(a_form->GetFormID())) {
+			return false;
 		}
+		if (a_filter.playable && (isSpell ? !spellTomes->GetTome(static_cast<const RE::SpellItem*>(a_form)) : !a_form->GetPlayable())) {
+			return false;
+		}
+		if (a_filter.any.empty() && a_filter.all.empty()) {
+			return true;
+		}
+		const auto keywordForm = a_form->As<RE::BGSKeywordForm>();
+		if (!keywordForm) {
+			return false;
+		}
+		if (!a_filter.any.empty() && !hasAny && std::none_of(a_filter.any.begin(), a_filter.any.end(), [&](const auto& a_keyword) { return keywordForm->HasKeyword(a_keyword); })) {
+			return false;
+		}
+		return std::all_of(a_filter.all.begin(), a_filter.all.end(), [&](const auto& a_keyword) { return keywordForm->HasKeyword(a_keyword); });
+	};
 
-		if (arr) {
-			for (auto& actorHandle : *arr) {
-				auto actorPtr = actorHandle.get();
-				auto actor = actorPtr.get();
-				if (actor) {
-					vec.push_back(actor);
-				}
+	if (candidates) {
+		for (const auto& form : *candidates) {
+			if (form && matches(form)) {
+				a_vec.push_back(form);
 			}
 		}
+	} else {
+		ScanForms(dataHandler->GetFormArray(a_formType), a_vec, matches);
 	}
-
-	return vec;
 }
 
 
-auto papyrusGame::GetAllEnchantments(VM*, StackID, RE::StaticFunctionTag*, std::vector<RE::BGSKeyword*> a_keywords) -> std::vector<RE::EnchantmentItem*>
+auto papyrusGame::GetAllFormsOfType(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, std::uint32_t a_formType, std::vector<RE::BGSKeyword*> a_any, std::vector<RE::BGSKeyword*> a_all, RE::BSFixedString a_plugin, bool a_playable) -> std::vector<RE::TESForm*>
 {
-	std::vector<RE::EnchantmentItem*> vec;
-	GetAllForms<RE::EnchantmentItem>(vec, a_keywords);
-	return vec;
+	std::vector<RE::TESForm*> vec;
+
+	const auto formType = static_cast<RE::FormType>(a_formType);
+	if (formType == RE::FormType::None || formType >= RE::FormType::Max) {
+		a_vm->TraceStack("Invalid form type", a_stackID, Severity::kWarning);
+		return vec;
+	}
+
+	FormFilter filter;
+	filter.playable = a_playable;
+
+	const auto isKeyword = [](const RE::BGSKeyword* a_keyword) { return a_keyword != nullptr; };
+	std::copy_if(a_any.begin(), a_any.end(), std::back_inserter(filter.any), isKeyword);
+	std::copy_if(a_all.begin(), a_all.end(), std::back_inserter(filter.all), isKeyword);
+
+	if (!a_plugin.empty()) {
+		filter.modInfo = FormIndex::Plugins::GetSingleton()->LookupMod(a_plugin);
+		if (!filter.modInfo) {
+			const auto msg = a_plugin.c_str() + std::string(" is not loaded"sv);
+			a_vm->TraceStack(msg.c_str(), a_stackID, Severity::kWarning);
+			return vec;
+		}
+	}
+
+	const auto key = FormIndex::Results::MakeKey(FormIndex::Results::QUERY::kGetAllOfType, formType, filter.any, filter.all, filter.modInfo, filter.playable);
+	return FormIndex::Results::GetSingleton()->Get<RE::TESForm>(key, [&]() {
+		QueryForms(formType, filter, vec);
+		return vec;
+	});
 }
 
 
 auto papyrusGame::GetAllRaces(VM*, StackID, RE::StaticFunctionTag*, std::vector<RE::BGSKeyword*> a_keywords) -> std::vector<RE::TESRace*>
 {
-	std::vector<RE::TESRace*> vec;
-	GetAllForms<RE::TESRace>(vec, a_keywords);
-	return vec;
+	const auto key = FormIndex::Results::MakeKey(FormIndex::Results::QUERY::kGetAll, RE::FormType::Race, a_keywords, {}, nullptr, false);
+	return FormIndex::Results::GetSingleton()->Get<RE::TESRace>(key, [&]() {
+		std::vector<RE::TESRace*> vec;
+		GetAllForms<RE::TESRace>(vec, a_keywords);
+		return vec;
+	});
 }
 
 
 auto papyrusGame::GetAllSpells(VM*, StackID, RE::StaticFunctionTag*, std::vector<RE::BGSKeyword*> a_keywords, bool a_playable) -> std::vector<RE::SpellItem*>
 {
-	std::vector<RE::SpellItem*> vec;
+	const auto key = FormIndex::Results::MakeKey(FormIndex::Results::QUERY::kGetAll, RE::FormType::Spell, a_keywords, {}, nullptr, a_playable);
+	return FormIndex::Results::GetSingleton()->Get<RE::SpellItem>(key, [&]() {
+		std::vector<RE::SpellItem*> vec;
 
-	if (a_playable) {
-		if (auto dataHandler = RE::TESDataHandler::GetSingleton(); dataHandler) {
-			for (const auto& book : dataHandler->GetFormArray<RE::TESObjectBOOK>()) {
-				if (book && book->data.flags.all(RE::OBJ_BOOK::Flag::kTeachesSpell)) {
-					auto spell = book->data.teaches.spell;
-					if (!spell || !a_keywords.empty() && !spell->HasKeywords(a_keywords)) {
-						continue;
-					}
+		if (a_playable) {
+			for (const auto& [book, spell] : FormIndex::SpellTomes::GetSingleton()->GetTomes()) {
+				if (a_keywords.empty() || spell->HasKeywords(a_keywords)) {
 					vec.push_back(spell);
 				}
 			}
+		} else {
+			GetAllForms<RE::SpellItem>(vec, a_keywords);
 		}
-	} else {
-		GetAllForms<RE::SpellItem>(vec, a_keywords);
-	}
 
-	return vec;
+		return vec;
+	});
 }
 
 
@@ -90,17 +167,18 @@ auto papyrusGame::GetAllEnchantmentsInMod(VM* a_vm, StackID a_stackID, RE::Stati
 		return vec;
 	}
 
-	if (auto dataHandler = RE::TESDataHandler::GetSingleton(); dataHandler) {
-		const auto modInfo = dataHandler->LookupModByName(a_name);
-		if (!modInfo) {
-			const auto msg = a_name.c_str() + std::string(" is not loaded"sv);
-			a_vm->TraceStack(msg.c_str(), a_stackID, Severity::kWarning);
-		} else {
-			GetAllFormsInMod<RE::EnchantmentItem>(modInfo, vec, a_keywords);
-		}
+	const auto modInfo = FormIndex::Plugins::GetSingleton()->LookupMod(a_name);
+	if (!modInfo) {
+		const auto msg = a_name.c_str() + std::string(" is not loaded"sv);
+		a_vm->TraceStack(msg.c_str(), a_stackID, Severity::kWarning);
+		return vec;
 	}
 
-	return vec;
+	const auto key = FormIndex::Results::MakeKey(FormIndex::Results::QUERY::kGetAllInMod, RE::FormType::Enchantment, a_keywords, {}, modInfo, false);
+	return FormIndex::Results::GetSingleton()->Get<RE::EnchantmentItem>(key, [&]() {
+		GetAllFormsInMod<RE::EnchantmentItem>(modInfo, vec, a_keywords);
+		return vec;
+	});
 }
 
 
@@ -113,17 +191,18 @@ auto papyrusGame::GetAllRacesInMod(VM* a_vm, StackID a_stackID, RE::StaticFuncti
 		return vec;
 	}
 
-	if (auto dataHandler = RE::TESDataHandler::GetSingleton(); dataHandler) {
-		const auto modInfo = dataHandler->LookupModByName(a_name);
-		if (!modInfo) {
-			const auto msg = a_name.c_str() + std::string(" is not loaded"sv);
-			a_vm->TraceStack(msg.c_str(), a_stackID, Severity::kWarning);
-		} else {
-			GetAllFormsInMod<RE::TESRace>(modInfo, vec, a_keywords);
-		}
+	const auto modInfo = FormIndex::Plugins::GetSingleton()->LookupMod(a_name);
+	if (!modInfo) {
+		const auto msg = a_name.c_str() + std::string(" is not loaded"sv);
+		a_vm->TraceStack(msg.c_str(), a_stackID, Severity::kWarning);
+		return vec;
 	}
 
-	return vec;
+	const auto key = FormIndex::Results::MakeKey(FormIndex::Results::QUERY::kGetAllInMod, RE::FormType::Race, a_keywords, {}, modInfo, false);
+	return FormIndex::Results::GetSingleton()->Get<RE::TESRace>(key, [&]() {
+		GetAllFormsInMod<RE::TESRace>(modInfo, vec, a_keywords);
+		return vec;
+	});
 }
 
 
@@ -136,30 +215,27 @@ auto papyrusGame::GetAllSpellsInMod(VM* a_vm, StackID a_stackID, RE::StaticFunct
 		return vec;
 	}
 
-	if (auto dataHandler = RE::TESDataHandler::GetSingleton(); dataHandler) {
-		const auto modInfo = dataHandler->LookupModByName(a_name);
-		if (!modInfo) {
-			const auto msg = a_name.c_str() + std::string(" is not loaded"sv);
-			a_vm->TraceStack(msg.c_str(), a_stackID, Severity::kWarning);
-			return vec;
-		}
+	const auto modInfo = FormIndex::Plugins::GetSingleton()->LookupMod(a_name);
+	if (!modInfo) {
+		const auto msg = a_name.c_str() + std::string(" is not loaded"sv);
+		a_vm->TraceStack(msg.c_str(), a_stackID, Severity::kWarning);
+		return vec;
+	}
+
+	const auto key = FormIndex::Results::MakeKey(FormIndex::Results::QUERY::kGetAllInMod, RE::FormType::Spell, a_keywords, {}, modInfo, a_playable);
+	return FormIndex::Results::GetSingleton()->Get<RE::SpellItem>(key, [&]() {
 		if (a_playable) {
-			for (const auto& book : dataHandler->GetFormArray<RE::TESObjectBOOK>()) {
-				if (!book || !modInfo->IsFormInMod(book->formID) || book->data.flags.none(RE::OBJ_BOOK::Flag::kTeachesSpell)) {
-					continue;
-				}
-				auto spell = book->data.teaches.spell;
-				if (!spell || !a_keywords.empty() && !spell->HasKeywords(a_keywords)) {
-					continue;
+			for (const auto& [book, spell] : FormIndex::SpellTomes::GetSingleton()->GetTomes(modInfo)) {
+				if (a_keywords.empty() || spell->HasKeywords(a_keywords)) {
+					vec.push_back(spell);
 				}
-				vec.push_back(spell);
 			}
 		} else {
 			GetAllFormsInMod<RE::SpellItem>(modInfo, vec, a_keywords);
 		}
-	}
 
-	return vec;
+		return vec;
+	});
 }
 
 
@@ -242,6 +318,27 @@ auto papyrusGame::GetNumActorsInHigh(VM*, StackID, RE::StaticFunctionTag*) -> st
 }
 
 
+auto papyrusGame::GetPapyrusExtenderCoSaveStats(VM*, StackID, RE::StaticFunctionTag*) -> std::vector<std::string>
+{
+	return Serialization::Telemetry::GetSingleton()->GetReport();
+}
+
+
+auto papyrusGame::GetPapyrusExtenderConditionStats(VM*, StackID, RE::StaticFunctionTag*) -> std::vector<std::string>
+{
+	const auto profiler = Condition::Profiler::GetSingleton();
+	profiler->LogReport();
+
+	return profiler->GetReport();
+}
+
+
+auto papyrusGame::GetPapyrusExtenderMemoryStats(VM*, StackID, RE::StaticFunctionTag*) -> std::vector<std::string>
+{
+	return MemoryStats::GetReport(true);
+}
+
+
 auto papyrusGame::GetPapyrusExtenderVersion(VM*, StackID, RE::StaticFunctionTag*) -> std::vector<std::int32_t>
 {
 	return { P3PE_VERSION_MAJOR, P3PE_VERSION_MINOR, P3PE_VERSION_PATCH };
@@ -254,14 +351,7 @@ auto papyrusGame::IsPluginFound(VM* a_vm, StackID a_stackID, RE::StaticFunctionT
 		a_vm->TraceStack("Mod name is empty", a_stackID, Severity::kWarning);
 	}
 
-	if (auto dataHandler = RE::TESDataHandler::GetSingleton(); dataHandler) {
-		const auto modInfo = dataHandler->LookupModByName(a_name);
-		if (modInfo) {
-			return true;
-		}
-	}
-
-	return false;
+	return FormIndex::Plugins::GetSingleton()->LookupMod(a_name) != nullptr;
 }
 
 
@@ -275,6 +365,12 @@ auto papyrusGame::IsSurvivalModeActive(VM*, StackID, RE::StaticFunctionTag*) ->
 }
 
 
+void papyrusGame::SetPapyrusExtenderConditionProfiling(VM*, StackID, RE::StaticFunctionTag*, bool a_enable)
+{
+	Condition::Profiler::GetSingleton()->SetEnabled(a_enable);
+}
+
+
 void papyrusGame::SetLocalGravity(VM*, StackID, RE::StaticFunctionTag*, float a_x, float a_y, float a_z)
 {
 	if (const auto player = RE::PlayerCharacter::GetSingleton(); player) {
@@ -303,6 +399,8 @@ auto papyrusGame::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("GetAllEnchantments"sv, Functions, GetAllEnchantments);
 
+	a_vm->RegisterFunction("GetAllFormsOfType"sv, Functions, GetAllFormsOfType);
+
 	a_vm->RegisterFunction("GetAllRaces"sv, Functions, GetAllRaces);
 
 	a_vm->RegisterFunction("GetAllSpells"sv, Functions, GetAllSpells);
@@ -321,6 +419,12 @@ auto papyrusGame::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("GetNumActorsInHigh"sv, Functions, GetNumActorsInHigh);
 
+	a_vm->RegisterFunction("GetPapyrusExtenderCoSaveStats"sv, Functions, GetPapyrusExtenderCoSaveStats);
+
+	a_vm->RegisterFunction("GetPapyrusExtenderConditionStats"sv, Functions, GetPapyrusExtenderConditionStats);
+
+	a_vm->RegisterFunction("GetPapyrusExtenderMemoryStats"sv, Functions, GetPapyrusExtenderMemoryStats);
+
 	a_vm->RegisterFunction("GetPapyrusExtenderVersion"sv, Functions, GetPapyrusExtenderVersion, true);
 
 	a_vm->RegisterFunction("IsSurvivalModeActive"sv, Functions, IsSurvivalModeActive);
@@ -329,5 +433,7 @@ auto papyrusGame::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("SetLocalGravity"sv, Functions, SetLocalGravity);
 
+	a_vm->RegisterFunction("SetPapyrusExtenderConditionProfiling"sv, Functions, SetPapyrusExtenderConditionProfiling);
+
 	return true;
 }
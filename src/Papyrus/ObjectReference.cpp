@@ -1,9 +1,16 @@
 #include "Papyrus/ObjectReference.h"
 
 #include "Serialization/Form/Keywords.h"
+#include "Util/ActorSnapshot.h"
+#include "Util/ConditionCache.h"
+#include "Util/ConditionEvaluator.h"
+#include "Util/Spatial.h"
 #include "Util/VMErrors.h"
 
 
+auto FindNearestVertex(RE::TESObjectREFR* a_ref, float a_radius = 0.0f) -> std::optional<RE::NiPoint3>;
+
+
 auto papyrusObjectReference::AddAllItemsToArray(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESObjectREFR* a_ref, bool a_noEquipped, bool a_noFavourited, bool a_noQuestItem) -> std::vector<RE::TESForm*>
 {
 	std::vector<RE::TESForm*> vec;
@@ -80,23 +87,48 @@ bool papyrusObjectReference::AttachModel(VM* a_vm, StackID a_stackID, RE::Static
 }
 
 
-auto papyrusObjectReference::FindAllReferencesOfFormType(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESObjectREFR* a_origin, std::uint32_t a_formType, float a_radius) -> std::vector<RE::TESObjectREFR*>
+auto papyrusObjectReference::FindAllReferencesMatchingConditions(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, std::vector<RE::BSFixedString> a_conditionList, RE::TESObjectREFR* a_origin, float a_radius) -> std::vector<RE::TESObjectREFR*>
 {
 	std::vector<RE::TESObjectREFR*> vec;
 
-	const auto TES = RE::TES::GetSingleton();
-	if (TES) {
-		const auto formType = static_cast<RE::FormType>(a_formType);
+	if (!a_origin) {
+		a_vm->TraceStack("Object Reference is None", a_stackID, Severity::kWarning);
+		return vec;
+	}
 
-		TES->ForEachReferenceInRange(a_origin, a_radius, [&](RE::TESObjectREFR& a_ref) {
-			auto base = a_ref.GetBaseObject();
-			if (formType == RE::FormType::None || a_ref.Is(formType) || base && base->Is(formType)) {
-				vec.push_back(&a_ref);
-			}
-			return true;
-		});
+	const auto conditions = Condition::Cache::GetSingleton()->GetOrderedChain(a_conditionList);
+	if (!conditions) {
+		a_vm->TraceStack("Failed to parse condition list", a_stackID, Severity::kWarning);
+		return vec;
 	}
 
+	const auto grid = Spatial::ReferenceGrid::GetSingleton();
+	grid->ForEachReferenceInRange(a_origin, a_radius, [&](RE::TESObjectREFR& a_ref) {
+		if (&a_ref != a_origin && Condition::IsTrue(conditions.get(), &a_ref, a_origin)) {
+			vec.push_back(&a_ref);
+		}
+		return true;
+	});
+
+	return vec;
+}
+
+
+auto papyrusObjectReference::FindAllReferencesOfFormType(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESObjectREFR* a_origin, std::uint32_t a_formType, float a_radius) -> std::vector<RE::TESObjectREFR*>
+{
+	std::vector<RE::TESObjectREFR*> vec;
+
+	const auto grid = Spatial::ReferenceGrid::GetSingleton();
+	const auto formType = static_cast<RE::FormType>(a_formType);
+
+	grid->ForEachReferenceInRange(a_origin, a_radius, [&](RE::TESObjectREFR& a_ref) {
+		auto base = a_ref.GetBaseObject();
+		if (formType == RE::FormType::None || a_ref.Is(formType) || base && base->Is(formType)) {
+			vec.push_back(&a_ref);
+		}
+		return true;
+	});
+
 	return vec;
 }
 
@@ -110,19 +142,17 @@ auto papyrusObjectReference::FindAllReferencesOfType(VM* a_vm, StackID a_stackID
 		return vec;
 	}
 
-	const auto TES = RE::TES::GetSingleton();
-	if (TES) {
-		const auto list = a_formOrList->As<RE::BGSListForm>();
+	const auto grid = Spatial::ReferenceGrid::GetSingleton();
+	const auto list = a_formOrList->As<RE::BGSListForm>();
 
-		TES->ForEachReferenceInRange(a_origin, a_radius, [&](RE::TESObjectREFR& a_ref) {
-			if (auto base = a_ref.GetBaseObject(); base) {
-				if (list && list->HasForm(base) || a_formOrList == base) {
-					vec.push_back(&a_ref);
-				}
+	grid->ForEachReferenceInRange(a_origin, a_radius, [&](RE::TESObjectREFR& a_ref) {
+		if (auto base = a_ref.GetBaseObject(); base) {
+			if (list && list->HasForm(base) || a_formOrList == base) {
+				vec.push_back(&a_ref);
 			}
-			return true;
-		});
-	}
+		}
+		return true;
+	});
 
 	return vec;
 }
@@ -137,30 +167,28 @@ auto papyrusObjectReference::FindAllReferencesWithKeyword(VM* a_vm, StackID a_st
 		return vec;
 	}
 
-	const auto TES = RE::TES::GetSingleton();
-	if (TES) {
-		const auto keyword = a_formOrList->As<RE::BGSKeyword>();
-		const auto list = a_formOrList->As<RE::BGSListForm>();
-
-		if (!keyword && !list) {
-			a_vm->TraceStack("FormOrList parameter has invalid formtype", a_stackID, Severity::kWarning);
-			return vec;
-		}
+	const auto grid = Spatial::ReferenceGrid::GetSingleton();
+	const auto keyword = a_formOrList->As<RE::BGSKeyword>();
+	const auto list = a_formOrList->As<RE::BGSListForm>();
 
-		TES->ForEachReferenceInRange(a_origin, a_radius, [&](RE::TESObjectREFR& a_ref) {
-			bool success = false;
-			if (list) {
-				success = a_matchAll ? a_ref.HasAllKeywords(list) : a_ref.HasKeywords(list);
-			} else if (keyword) {
-				success = a_ref.HasKeyword(keyword);
-			}
-			if (success) {
-				vec.push_back(&a_ref);
-			}
-			return true;
-		});
+	if (!keyword && !list) {
+		a_vm->TraceStack("FormOrList parameter has invalid formtype", a_stackID, Severity::kWarning);
+		return vec;
 	}
 
+	grid->ForEachReferenceInRange(a_origin, a_radius, [&](RE::TESObjectREFR& a_ref) {
+		bool success = false;
+		if (list) {
+			success = a_matchAll ? a_ref.HasAllKeywords(list) : a_ref.HasKeywords(list);
+		} else if (keyword) {
+			success = a_ref.HasKeyword(keyword);
+		}
+		if (success) {
+			vec.push_back(&a_ref);
+		}
+		return true;
+	});
+
 	return vec;
 }
 
@@ -276,6 +304,52 @@ auto papyrusObjectReference::GetActorCause(VM* a_vm, StackID a_stackID, RE::Stat
 }
 
 
+auto papyrusObjectReference::GetActorsMatchingConditions(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, std::vector<RE::BSFixedString> a_conditionList, RE::TESObjectREFR* a_origin, float a_radius) -> std::vector<RE::Actor*>
+{
+	std::vector<RE::Actor*> vec;
+
+	if (!a_origin) {
+		a_vm->TraceStack("Object Reference is None", a_stackID, Severity::kWarning);
+		return vec;
+	}
+
+	const auto conditions = Condition::Cache::GetSingleton()->GetOrderedChain(a_conditionList);
+	if (!conditions) {
+		a_vm->TraceStack("Failed to parse condition list", a_stackID, Severity::kWarning);
+		return vec;
+	}
+
+	const auto squaredRadius = a_radius * a_radius;
+	const auto originPos = a_origin->GetPosition();
+
+	const auto isMatch = [&](RE::Actor* a_actor) {
+		if (a_actor == a_origin) {
+			return false;
+		}
+		if (a_radius > 0.0f && originPos.GetSquaredDistance(a_actor->GetPosition()) > squaredRadius) {
+			return false;
+		}
+		return Condition::IsTrue(conditions.get(), a_actor, a_origin);
+	};
+
+	if (auto processLists = RE::ProcessLists::GetSingleton(); processLists) {
+		for (auto& actorHandle : processLists->highActorHandles) {
+			auto actorPtr = actorHandle.get();
+			auto actor = actorPtr.get();
+			if (actor && isMatch(actor)) {
+				vec.push_back(actor);
+			}
+		}
+	}
+
+	if (auto player = RE::PlayerCharacter::GetSingleton(); player && isMatch(player)) {
+		vec.push_back(player);
+	}
+
+	return vec;
+}
+
+
 auto papyrusObjectReference::GetAllArtObjects(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESObjectREFR* a_ref) -> std::vector<RE::BGSArtObject*>
 {
 	std::vector<RE::BGSArtObject*> vec;
@@ -331,44 +405,12 @@ auto papyrusObjectReference::GetClosestActorFromRef(VM* a_vm, StackID a_stackID,
 		return nullptr;
 	}
 
-	if (auto processLists = RE::ProcessLists::GetSingleton(); processLists) {
-		if (a_ignorePlayer && processLists->numberHighActors == 0) {
-			return nullptr;
-		}
-
-		const auto originPos = a_ref->GetPosition();
-		auto shortestDistance = std::numeric_limits<float>::max();
-
-		std::map<RE::Actor*, float> map;
-		for (auto& actorHandle : processLists->highActorHandles) {
-			auto actorPtr = actorHandle.get();
-			auto actor = actorPtr.get();
-			if (actor && actor != a_ref) {
-				auto distance = originPos.GetDistance(actorPtr->GetPosition());
-				map.emplace(actor, distance);
-				if (distance < shortestDistance) {
-					shortestDistance = distance;
-				}
-			}
-		}
-
-		if (!a_ignorePlayer) {
-			auto player = RE::PlayerCharacter::GetSingleton();
-			if (player && a_ref != player) {
-				auto distance = originPos.GetDistance(player->GetPosition());
-				map.emplace(player, distance);
-				if (distance < shortestDistance) {
-					shortestDistance = distance;
-				}
-			}
-		}
+	const auto snapshot = Actors::Snapshot::Get();
+	const auto& actors = snapshot->GetPositions();
 
-		const auto it = std::find_if(map.begin(), map.end(), [shortestDistance](const auto& mo) {
-			return SKSE::FLOAT::approximatelyEqual(mo.second, shortestDistance);
-		});
-		if (it != map.end()) {
-			return it->first;
-		}
+	const auto nearest = actors.GetNearest(a_ref->GetPosition(), a_ref, a_ignorePlayer);
+	if (nearest != Spatial::ActorPositions::npos) {
+		return actors.GetActor(nearest);
 	}
 
 	return nullptr;
@@ -612,49 +654,55 @@ auto papyrusObjectReference::GetMotionType(VM* a_vm, StackID a_stackID, RE::Stat
 }
 
 
-auto papyrusObjectReference::GetRandomActorFromRef(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESObjectREFR* a_ref, float a_radius, bool a_ignorePlayer) -> RE::Actor*
+auto papyrusObjectReference::GetNearestActorsFromRef(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESObjectREFR* a_ref, std::uint32_t a_count, float a_radius) -> std::vector<RE::Actor*>
 {
-	using RNG = SKSE::RNG;
+	std::vector<RE::Actor*> vec;
 
 	if (!a_ref) {
 		a_vm->TraceStack("Object Reference is None", a_stackID, Severity::kWarning);
-		return nullptr;
+		return vec;
 	}
 
-	if (auto processLists = RE::ProcessLists::GetSingleton(); processLists) {
-		if (a_ignorePlayer && processLists->numberHighActors == 0) {
-			return nullptr;
-		}
+	const auto snapshot = Actors::Snapshot::Get();
+	snapshot->GetPositions().GetNearest(a_ref->GetPosition(), a_ref, false, a_count, a_radius, vec);
 
-		const auto squaredRadius = a_radius * a_radius;
-		const auto originPos = a_ref->GetPosition();
+	return vec;
+}
 
-		std::vector<RE::Actor*> vec;
-		vec.reserve(processLists->numberHighActors);
 
-		for (auto& actorHandle : processLists->highActorHandles) {
-			auto actorPtr = actorHandle.get();
-			auto actor = actorPtr.get();
-			if (!actor || actor == a_ref) {
-				continue;
-			}
-			if (originPos.GetSquaredDistance(actor->GetPosition()) > squaredRadius) {
-				continue;
-			}
-			vec.emplace_back(actor);
-		}
+auto papyrusObjectReference::GetNearestNavmeshPoint(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESObjectREFR* a_ref, float a_radius) -> std::vector<float>
+{
+	std::vector<float> vec;
 
-		if (!a_ignorePlayer) {
-			if (auto player = RE::PlayerCharacter::GetSingleton(); player && a_ref != player) {
-				if (originPos.GetSquaredDistance(player->GetPosition()) <= squaredRadius) {
-					vec.emplace_back(player);
-				}
-			}
-		}
+	if (!a_ref) {
+		a_vm->TraceStack("Object Reference is None", a_stackID, Severity::kWarning);
+		return vec;
+	}
 
-		if (!vec.empty()) {
-			return vec[RNG::GetSingleton()->Generate<size_t>(0, vec.size() - 1)];
-		}
+	if (const auto nearestVertex = FindNearestVertex(a_ref, a_radius); nearestVertex) {
+		vec = { nearestVertex->x, nearestVertex->y, nearestVertex->z };
+	}
+
+	return vec;
+}
+
+
+auto papyrusObjectReference::GetRandomActorFromRef(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::TESObjectREFR* a_ref, float a_radius, bool a_ignorePlayer) -> RE::Actor*
+{
+	using RNG = SKSE::RNG;
+
+	if (!a_ref) {
+		a_vm->TraceStack("Object Reference is None", a_stackID, Severity::kWarning);
+		return nullptr;
+	}
+
+	const auto snapshot = Actors::Snapshot::Get();
+
+	std::vector<RE::Actor*> vec;
+	snapshot->GetPositions().GetInRange(a_ref->GetPosition(), a_ref, a_ignorePlayer, a_radius, vec);
+
+	if (!vec.empty()) {
+		return vec[RNG::GetSingleton()->Generate<size_t>(0, vec.size() - 1)];
 	}
 
 	return nullptr;
@@ -822,28 +870,9 @@ auto papyrusObjectReference::HasNiExtraData(VM* a_vm, StackID a_stackID, RE::Sta
 }
 
 
-auto FindNearestVertex(RE::TESObjectREFR* a_ref) -> std::optional<RE::NiPoint3>
+auto FindNearestVertex(RE::TESObjectREFR* a_ref, float a_radius) -> std::optional<RE::NiPoint3>
 {
-	const auto cell = a_ref->GetParentCell();
-	if (!cell || !cell->navMeshes) {
-		return std::nullopt;
-	}
-
-	auto& navMeshes = *cell->navMeshes;
-	auto shortestDistance = std::numeric_limits<float>::max();
-	std::optional<RE::NiPoint3> pos = std::nullopt;
-
-	for (auto& navMesh : navMeshes.navMeshes) {
-		for (auto& vertex : navMesh->vertices) {
-			const auto linearDistance = a_ref->GetPosition().GetDistance(vertex.location);
-			if (linearDistance < shortestDistance) {
-				shortestDistance = linearDistance;
-				pos.emplace(vertex.location);
-			}
-		}
-	}
-
-	return pos;
+	return Spatial::NavmeshGrid::GetSingleton()->GetNearestVertex(a_ref->GetParentCell(), a_ref->GetPosition(), a_radius);
 }
 
 
@@ -1617,6 +1646,8 @@ auto papyrusObjectReference::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("AddKeywordToRef"sv, Functions, AddKeywordToRef);
 
+	a_vm->RegisterFunction("FindAllReferencesMatchingConditions"sv, Functions, FindAllReferencesMatchingConditions);
+
 	a_vm->RegisterFunction("FindAllReferencesOfFormType"sv, Functions, FindAllReferencesOfFormType);
 
 	a_vm->RegisterFunction("FindAllReferencesOfType"sv, Functions, FindAllReferencesOfType);
@@ -1631,6 +1662,8 @@ auto papyrusObjectReference::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("GetActorCause"sv, Functions, GetActorCause);
 
+	a_vm->RegisterFunction("GetActorsMatchingConditions"sv, Functions, GetActorsMatchingConditions);
+
 	a_vm->RegisterFunction("GetAllArtObjects"sv, Functions, GetAllArtObjects);
 
 	a_vm->RegisterFunction("GetAllEffectShaders"sv, Functions, GetAllEffectShaders);
@@ -1649,6 +1682,10 @@ auto papyrusObjectReference::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("GetMotionType"sv, Functions, GetMotionType);
 
+	a_vm->RegisterFunction("GetNearestActorsFromRef"sv, Functions, GetNearestActorsFromRef);
+
+	a_vm->RegisterFunction("GetNearestNavmeshPoint"sv, Functions, GetNearestNavmeshPoint);
+
 	a_vm->RegisterFunction("GetRandomActorFromRef"sv, Functions, GetRandomActorFromRef);
 
 	a_vm->RegisterFunction("GetQuestItems"sv, Functions, GetQuestItems);
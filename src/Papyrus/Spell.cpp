@@ -1,6 +1,7 @@
 #include "Papyrus/Spell.h"
 
-#include "Util/ConditionParser.h"
+#include "Util/ConditionCache.h"
+#include "Util/FormIndex.h"
 
 
 void papyrusSpell::AddMagicEffectToSpell(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::SpellItem* a_spell, RE::EffectSetting* a_mgef, float a_mag, std::uint32_t a_area, std::uint32_t a_dur, float a_cost, std::vector<RE::BSFixedString> a_conditionList)
@@ -33,28 +34,10 @@ void papyrusSpell::AddMagicEffectToSpell(VM* a_vm, StackID a_stackID, RE::Static
 			effect->cost = a_cost;
 
 			if (!a_conditionList.empty() && !a_conditionList.front().empty()) {
-				auto conditions = Condition::ParseConditions(a_conditionList);
-				if (!conditions.empty()) {
-					for (auto& [object, functionID, param1, param2, opCode, value, ANDOR] : conditions) {
-						auto newNode = new RE::TESConditionItem;
-						if (newNode) {
-							newNode->next = nullptr;
-							newNode->data.object = object;
-							newNode->data.functionData.function = functionID;
-							newNode->data.functionData.params[0] = param1;
-							newNode->data.functionData.params[1] = param2;
-							newNode->data.flags.opCode = opCode;
-							newNode->data.comparisonValue.f = value;
-							newNode->data.flags.isOR = ANDOR;
-
-							if (effect->conditions.head == nullptr) {
-								effect->conditions.head = newNode;
-							} else {
-								newNode->next = effect->conditions.head;
-								effect->conditions.head = newNode;
-							}
-						}
-					}
+				const auto chain = Condition::Cache::GetSingleton()->CreateChain(a_conditionList);
+				if (chain) {
+					effect->conditions.head = chain;
+					Condition::Cache::GetSingleton()->Invalidate(&effect->conditions);
 				} else {
 					a_vm->TraceStack("Failed to parse condition list", a_stackID, Severity::kInfo);
 				}
@@ -97,38 +80,25 @@ void papyrusSpell::AddEffectItemToSpell(VM* a_vm, StackID a_stackID, RE::StaticF
 			effect->effectItem.duration = copyEffect->effectItem.duration;
 			effect->baseEffect = copyEffect->baseEffect;
 			effect->cost = a_cost == -1.0f ? copyEffect->cost : a_cost;
-			effect->conditions = copyEffect->conditions;
-
-			auto head = copyEffect->conditions.head;
-			while (head) {
-				auto newNode = new RE::TESConditionItem;
-				if (newNode) {
-					newNode->next = nullptr;
-					newNode->data.comparisonValue = head->data.comparisonValue;
-					newNode->data.runOnRef = head->data.runOnRef;
-					newNode->data.object = head->data.object;
-					newNode->data.dataID = head->data.dataID;
-					newNode->data.functionData.function = head->data.functionData.function;
-					newNode->data.functionData.params[0] = head->data.functionData.params[0];
-					newNode->data.functionData.params[1] = head->data.functionData.params[1];
-					newNode->data.flags = head->data.flags;
-					newNode->data.object = head->data.object;
-
-					if (effect->conditions.head == nullptr) {
-						effect->conditions.head = newNode;
-					} else {
-						newNode->next = effect->conditions.head;
-						effect->conditions.head = newNode;
-					}
-				}
-				head = head->next;
-			}			
+			effect->conditions.head = Condition::Cache::CopyChain(copyEffect->conditions.head);
+			Condition::Cache::GetSingleton()->Invalidate(&effect->conditions);
 			a_spell->effects.push_back(effect);
 		}
 	}
 }
 
 
+auto papyrusSpell::GetSpellTomeForSpell(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::SpellItem* a_spell) -> RE::TESObjectBOOK*
+{
+	if (!a_spell) {
+		a_vm->TraceStack("Spell is None", a_stackID, Severity::kWarning);
+		return nullptr;
+	}
+
+	return FormIndex::SpellTomes::GetSingleton()->GetTome(a_spell);
+}
+
+
 auto papyrusSpell::GetSpellType(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::SpellItem* a_spell) -> std::int32_t
 {
 	if (!a_spell) {
@@ -198,6 +168,8 @@ auto papyrusSpell::RegisterFuncs(VM* a_vm) -> bool
 
 	a_vm->RegisterFunction("AddEffectItemToSpell"sv, Functions, AddEffectItemToSpell);
 
+	a_vm->RegisterFunction("GetSpellTomeForSpell"sv, Functions, GetSpellTomeForSpell);
+
 	a_vm->RegisterFunction("GetSpellType"sv, Functions, GetSpellType);
 
 	a_vm->RegisterFunction("RemoveMagicEffectFromSpell"sv, Functions, RemoveMagicEffectFromSpell);
@@ -47,6 +47,16 @@ namespace Serialization
 	}
 
 
+	std::pair<std::size_t, std::size_t> Base::GetMemoryUsage() const
+	{
+		Locker locker(_lock);
+		return {
+			_add.size() + _remove.size(),
+			MemoryStats::GetHeapSize(_add) + MemoryStats::GetHeapSize(_remove)
+		};
+	}
+
+
 	bool Base::Save(SKSE::SerializationInterface* a_intfc, std::uint32_t a_type, std::uint32_t a_version, std::uint32_t a_add)
 	{
 		if (!a_intfc->OpenRecord(a_type, a_version)) {
@@ -74,7 +84,7 @@ namespace Serialization
 	}
 
 
-	bool Base::Load(SKSE::SerializationInterface* a_intfc, std::uint32_t a_add)
+	bool Base::Load(SKSE::SerializationInterface* a_intfc, std::uint32_t a_add, std::uint32_t* a_unresolved)
 	{
 		assert(a_intfc);
 		std::uint32_t size;
@@ -90,6 +100,9 @@ namespace Serialization
 			a_intfc->ReadRecordData(formID);
 			if (!a_intfc->ResolveFormID(formID, formID)) {
 				logger::error("{} : {} : Failed to resolve formID {}"sv, a_add, i, formID);
+				if (a_unresolved) {
+					++*a_unresolved;
+				}
 				continue;
 			}
 
@@ -97,6 +110,9 @@ namespace Serialization
 			a_intfc->ReadRecordData(dataID);
 			if (!a_intfc->ResolveFormID(dataID, dataID)) {
 				logger::error("{} : {} : Failed to resolve dataID {}"sv, a_add, i, dataID);
+				if (a_unresolved) {
+					++*a_unresolved;
+				}
 				continue;
 			}
 						
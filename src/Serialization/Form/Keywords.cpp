@@ -1,5 +1,7 @@
 #include "Serialization/Form/Keywords.h"
 
+#include "Util/FormIndex.h"
+
 
 namespace Serialization
 {
@@ -37,6 +39,9 @@ namespace Serialization
 		if (keywordForm) {
 			success = a_add == kAdd ? keywordForm->AddKeyword(a_keyword) : keywordForm->RemoveKeyword(a_keyword);
 		}
+		if (success) {
+			FormIndex::Keywords::GetSingleton()->Update(a_form, a_keyword, a_add == kAdd);
+		}
 
 		return success;
 	}
@@ -0,0 +1,122 @@
+#include "Serialization/HandleIndex.h"
+
+
+namespace Serialization
+{
+	HandleIndex* HandleIndex::GetSingleton()
+	{
+		static HandleIndex singleton;
+		return &singleton;
+	}
+
+
+	RE::VMHandle HandleIndex::GetHandle(RE::VMTypeID a_typeID, const void* a_object)
+	{
+		const auto vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
+		const auto policy = vm ? vm->GetObjectHandlePolicy() : nullptr;
+		if (!policy || !a_object) {
+			return 0;
+		}
+		return policy->GetHandleForObject(a_typeID, a_object);
+	}
+
+
+	RE::VMHandle HandleIndex::GetHandle(const RE::TESForm* a_form)
+	{
+		return a_form ? GetHandle(static_cast<RE::VMTypeID>(a_form->GetFormType()), a_form) : 0;
+	}
+
+
+	RE::VMHandle HandleIndex::GetHandle(const RE::BGSBaseAlias* a_alias)
+	{
+		return a_alias ? GetHandle(a_alias->GetVMTypeID(), a_alias) : 0;
+	}
+
+
+	RE::VMHandle HandleIndex::GetHandle(const RE::ActiveEffect* a_activeEffect)
+	{
+		return GetHandle(RE::ActiveEffect::VMTYPEID, a_activeEffect);
+	}
+
+
+	void HandleIndex::Add(RE::VMHandle a_handle, std::uint32_t a_event)
+	{
+		if (a_handle == 0) {
+			return;
+		}
+
+		Locker locker(_lock);
+		auto& entry = _entries[a_handle];
+		if (entry.refs[a_event]++ == 0) {
+			entry.mask |= Mask(1) << a_event;
+			_counts[a_event]++;
+		}
+	}
+
+
+	void HandleIndex::Remove(RE::VMHandle a_handle, std::uint32_t a_event)
+	{
+		Locker locker(_lock);
+		const auto it = _entries.find(a_handle);
+		if (it == _entries.end()) {
+			return;
+		}
+
+		if (const auto ref = it->second.refs.find(a_event); ref != it->second.refs.end() && --ref->second == 0) {
+			Erase(it, a_event);
+		}
+	}
+
+
+	void HandleIndex::RemoveAll(RE::VMHandle a_handle, std::uint32_t a_event)
+	{
+		Locker locker(_lock);
+		if (const auto it = _entries.find(a_handle); it != _entries.end()) {
+			Erase(it, a_event);
+		}
+	}
+
+
+	void HandleIndex::Clear(std::uint32_t a_event)
+	{
+		const Mask bit = Mask(1) << a_event;
+
+		Locker locker(_lock);
+		for (auto it = _entries.begin(); it != _entries.end();) {
+			it->second.mask &= ~bit;
+			it->second.refs.erase(a_event);
+			it = it->second.mask == 0 ? _entries.erase(it) : std::next(it);
+		}
+		_counts[a_event] = 0;
+	}
+
+
+	void HandleIndex::Erase(std::unordered_map<RE::VMHandle, Entry>::iterator a_it, std::uint32_t a_event)
+	{
+		auto& entry = a_it->second;
+		if (entry.refs.erase(a_event) == 0) {
+			return;
+		}
+
+		entry.mask &= ~(Mask(1) << a_event);
+		_counts[a_event]--;
+		if (entry.mask == 0) {
+			_entries.erase(a_it);
+		}
+	}
+
+
+	auto HandleIndex::GetMask(RE::VMHandle a_handle) const -> Mask
+	{
+		Locker locker(_lock);
+		const auto it = _entries.find(a_handle);
+		return it != _entries.end() ? it->second.mask : 0;
+	}
+
+
+	std::size_t HandleIndex::GetCount(std::uint32_t a_event) const
+	{
+		Locker locker(_lock);
+		return _counts[a_event];
+	}
+}
@@ -1,223 +1,231 @@
 #include "Serialization/Manager.h"
 
+#include "Serialization/ConditionalEvents.h"
 #include "Serialization/Events.h"
 #include "Serialization/Form/Keywords.h"
 #include "Serialization/Form/Perks.h"
+#include "Serialization/Telemetry.h"
+#include "Util/MemoryStats.h"
 
 
 namespace Serialization
 {
-	std::string DecodeTypeCode(std::uint32_t a_typeCode)
+	namespace
 	{
-		constexpr std::size_t SIZE = sizeof(std::uint32_t);
-
-		std::string sig;
-		sig.resize(SIZE);
-		char* iter = reinterpret_cast<char*>(&a_typeCode);
-		for (std::size_t i = 0, j = SIZE - 2; i < SIZE - 1; ++i, --j) {
-			sig[j] = iter[i];
-		}
-		return sig;
-	}
-
+		void SaveForms(SKSE::SerializationInterface* a_intfc, Form::Base* a_forms, std::uint32_t a_type, std::uint32_t a_add, std::string_view a_name)
+		{
+			auto& data = a_forms->GetData(a_add);
+			if (data.empty()) {
+				return;
+			}
 
-	void SaveCallback(SKSE::SerializationInterface* a_intfc)
-	{
-		using namespace Form;
-		using namespace ScriptEvents;
-		using namespace StoryEvents;
-		using namespace HookedEvents;
-		using namespace FECEvents;
+			auto telemetry = Telemetry::GetSingleton();
+			telemetry->BeginRecord(a_type);
 
-		//forms
-		auto perks = Perks::GetSingleton();
-		if (!perks->GetData(kAdd).empty()) {
-			if (!perks->Save(a_intfc, kAddPerks, kSerializationVersion, kAdd)) {
-				logger::critical("[Add Perks] : Failed to save data!"sv);
-				perks->Clear(kAdd);
-			}
-		}
-		if (!perks->GetData(kRemove).empty()) {
-			if (!perks->Save(a_intfc, kRemovePerks, kSerializationVersion, kRemove)) {
-				logger::critical("[Remove Perks] : Failed to save data!"sv);
-				perks->Clear(kRemove);
+			const auto entries = data.size();
+			const auto bytes = sizeof(std::uint32_t) + entries * 2 * sizeof(RE::FormID);  //size, then formID/dataID pairs
+			if (!a_forms->Save(a_intfc, a_type, kSerializationVersion, a_add)) {
+				logger::critical("[{}] : Failed to save data!"sv, a_name);
+				a_forms->Clear(a_add);
 			}
+			telemetry->EndRecord(entries, bytes);
 		}
 
-		auto keywords = Keywords::GetSingleton();
-		if (!keywords->GetData(kAdd).empty()) {
-			if (!keywords->Save(a_intfc, kAddKeywords, kSerializationVersion, kAdd)) {
-				logger::critical("[Add Keywords] : Failed to save data!"sv);
-				keywords->Clear(true);
-			}
-		}
-		if (!keywords->GetData(kRemove).empty()) {
-			if (!keywords->Save(a_intfc, kRemoveKeywords, kSerializationVersion, kRemove)) {
-				logger::critical("[Remove Keywords] : Failed to save data!"sv);
-				keywords->Clear(kRemove);
+
+		std::size_t LoadForms(SKSE::SerializationInterface* a_intfc, Form::Base* a_forms, std::uint32_t a_add, std::string_view a_name, std::uint32_t& a_unresolved)
+		{
+			a_forms->Clear(a_add);
+			if (!a_forms->Load(a_intfc, a_add, std::addressof(a_unresolved))) {
+				logger::critical("Failed to load {} reg!"sv, a_name);
+			} else {
+				a_forms->LoadData(a_add);
 			}
+			return a_forms->GetData(a_add).size();
 		}
 
-		//script events
-		auto cellFullyLoaded = OnCellFullyLoadedRegSet::GetSingleton();
-		if (!cellFullyLoaded->Save(a_intfc, kOnCellFullyLoaded, kSerializationVersion)) {
-			logger::critical("Failed to save OnCellFullyLoaded regs!"sv);
-		}
 
-		auto questStart = OnQuestStartRegMap::GetSingleton();
-		if (!questStart->Save(a_intfc, kQuestStart, kSerializationVersion)) {
-			logger::critical("Failed to save QuestStart regs!"sv);
-		}
+		template <class T>
+		void SaveRegs(SKSE::SerializationInterface* a_intfc, T* a_regs)
+		{
+			if (a_regs->Empty()) {  //cleared on revert, so there's nothing stale to overwrite
+				return;
+			}
 
-		auto questStop = OnQuestStopRegMap::GetSingleton();
-		if (!questStop->Save(a_intfc, kQuestStop, kSerializationVersion)) {
-			logger::critical("Failed to save QuestStop regs!"sv);
-		}
+			const auto& event = EVENTS[to_underlying(T::GetEvent())];
 
-		auto questStage = OnQuestStageRegMap::GetSingleton();
-		if (!questStage->Save(a_intfc, kQuestStage, kSerializationVersion)) {
-			logger::critical("Failed to save QuestStage regs!"sv);
-		}
+			auto telemetry = Telemetry::GetSingleton();
+			telemetry->BeginRecord(event.record);
 
-		auto objectLoad = OnObjectLoadedRegMap::GetSingleton();
-		if (!objectLoad->Save(a_intfc, kObjectLoaded, kSerializationVersion)) {
-			logger::critical("Failed to save ObjectLoaded regs!"sv);
+			if (!a_regs->Save(a_intfc, event.record, kSerializationVersion)) {
+				logger::critical("Failed to save {} regs!"sv, event.name);
+			}
+			telemetry->EndRecord(a_regs->GetNumRegistrations(), std::nullopt);  //layout is written by CommonLib
 		}
 
-		auto objectUnload = OnObjectUnloadedRegMap::GetSingleton();
-		if (!objectUnload->Save(a_intfc, kObjectUnloaded, kSerializationVersion)) {
-			logger::critical("Failed to save ObjectUnloaded regs!"sv);
-		}
 
-		auto objectGrab = OnGrabRegSet::GetSingleton();
-		if (!objectGrab->Save(a_intfc, kGrab, kSerializationVersion)) {
-			logger::critical("Failed to save ObjectGrab regs!"sv);
+		template <class T>
+		std::size_t LoadRegs(SKSE::SerializationInterface* a_intfc, T* a_regs)
+		{
+			a_regs->Clear();
+			if (!a_regs->Load(a_intfc)) {
+				logger::critical("Failed to load {} regs!"sv, EVENTS[to_underlying(T::GetEvent())].name);
+			}
+			return a_regs->GetNumRegistrations();
 		}
 
-		auto objectRelease = OnReleaseRegSet::GetSingleton();
-		if (!objectRelease->Save(a_intfc, kRelease, kSerializationVersion)) {
-			logger::critical("Failed to save ObjectRelease regs!"sv);
-		}
 
-		// story events
-		auto actorKill = OnActorKillRegSet::GetSingleton();
-		if (!actorKill->Save(a_intfc, kActorKill, kSerializationVersion)) {
-			logger::critical("Failed to save ActorKill regs!"sv);
+		// record type -> registration, dispatched through the event table
+		std::optional<std::size_t> LoadRegs(SKSE::SerializationInterface* a_intfc, std::uint32_t a_type)
+		{
+			std::optional<std::size_t> entries;
+			ForEachRegistration([&](auto* a_regs) {
+				using Regs = std::remove_pointer_t<decltype(a_regs)>;
+				if (!entries && EVENTS[to_underlying(Regs::GetEvent())].record == a_type) {
+					entries = LoadRegs(a_intfc, a_regs);
+				}
+			});
+			return entries;
 		}
 
-		auto booksRead = OnBooksReadRegSet::GetSingleton();
-		if (!booksRead->Save(a_intfc, kBookRead, kSerializationVersion)) {
-			logger::critical("Failed to save BooksRead regs!"sv);
-		}
 
-		auto criticalHit = OnCriticalHitRegSet::GetSingleton();
-		if (!criticalHit->Save(a_intfc, kCritHit, kSerializationVersion)) {
-			logger::critical("Failed to save CriticalHit regs!"sv);
-		}
+		// one record for every conditional event : event, groups
+		void SaveConditionalRegs(SKSE::SerializationInterface* a_intfc)
+		{
+			std::uint32_t numEvents = 0;
+			ForEachConditionalRegistration([&](auto* a_regs) {
+				if (!a_regs->Empty()) {
+					numEvents++;
+				}
+			});
+			if (numEvents == 0) {
+				return;
+			}
 
-		auto disarmed = OnDisarmedRegSet::GetSingleton();
-		if (!disarmed->Save(a_intfc, kDisarm, kSerializationVersion)) {
-			logger::critical("Failed to save Disarmed regs!"sv);
+			auto telemetry = Telemetry::GetSingleton();
+			telemetry->BeginRecord(kConditionalEvents);
+
+			std::size_t entries = 0;
+			if (!a_intfc->OpenRecord(kConditionalEvents, kSerializationVersion)) {
+				logger::critical("Failed to save conditional regs!"sv);
+			} else {
+				a_intfc->WriteRecordData(numEvents);
+				ForEachConditionalRegistration([&](auto* a_regs) {
+					using Regs = std::remove_pointer_t<decltype(a_regs)>;
+					if (a_regs->Empty()) {
+						return;
+					}
+					a_intfc->WriteRecordData(to_underlying(Regs::GetEvent()));
+					if (!a_regs->Save(a_intfc)) {
+						logger::critical("Failed to save conditional {} regs!"sv, EVENTS[to_underlying(Regs::GetEvent())].name);
+					}
+					entries += a_regs->GetNumGroups();
+				});
+			}
+			telemetry->EndRecord(entries, std::nullopt);
 		}
 
-		auto dragonSoul = OnDragonSoulsGainedRegSet::GetSingleton();
-		if (!dragonSoul->Save(a_intfc, kDragonSoul, kSerializationVersion)) {
-			logger::critical("Failed to save DragonSoul regs!"sv);
-		}
 
-		auto harvest = OnItemHarvestedRegSet::GetSingleton();
-		if (!harvest->Save(a_intfc, kHarvest, kSerializationVersion)) {
-			logger::critical("Failed to save ItemHarvested regs!"sv);
-		}
+		std::size_t LoadConditionalRegs(SKSE::SerializationInterface* a_intfc)
+		{
+			std::uint32_t numEvents;
+			a_intfc->ReadRecordData(numEvents);
 
-		auto levelIncrease = OnLevelIncreaseRegSet::GetSingleton();
-		if (!levelIncrease->Save(a_intfc, kLevelIncrease, kSerializationVersion)) {
-			logger::critical("Failed to save LevelIncrease regs!"sv);
-		}
+			std::size_t entries = 0;
+			for (std::uint32_t i = 0; i < numEvents; i++) {
+				std::uint32_t event;
+				a_intfc->ReadRecordData(event);
 
-		auto locDiscovery = OnLocationDiscoveryRegSet::GetSingleton();
-		if (!locDiscovery->Save(a_intfc, kLocDiscovery, kSerializationVersion)) {
-			logger::critical("Failed to save LocDiscovery regs!"sv);
-		}
+				bool found = false;
+				bool loaded = false;
+				ForEachConditionalRegistration([&](auto* a_regs) {
+					using Regs = std::remove_pointer_t<decltype(a_regs)>;
+					if (found || to_underlying(Regs::GetEvent()) != event) {
+						return;
+					}
+					found = true;
+					loaded = a_regs->Load(a_intfc);
+					if (!loaded) {
+						logger::critical("Failed to load conditional {} regs!"sv, EVENTS[to_underlying(Regs::GetEvent())].name);
+					}
+					entries += a_regs->GetNumGroups();
+				});
 
-		auto skillIncrease = OnSkillIncreaseRegSet::GetSingleton();
-		if (!skillIncrease->Save(a_intfc, kSkillIncrease, kSerializationVersion)) {
-			logger::critical("Failed to save SkillIncrease regs!"sv);
+				//the rest of the record can't be read without knowing this event's layout, or after a group was cut short
+				if (!found) {
+					logger::critical("Unrecognized conditional event ({})!"sv, event);
+					break;
+				}
+				if (!loaded) {
+					break;
+				}
+			}
+			return entries;
 		}
+	}
 
-		auto shoutAttack = OnShoutAttackRegSet::GetSingleton();
-		if (!shoutAttack->Save(a_intfc, kShoutAttack, kSerializationVersion)) {
-			logger::critical("Failed to save ShoutAttack regs!"sv);
-		}
 
-		auto soulTrap = OnSoulsTrappedRegSet::GetSingleton();
-		if (!soulTrap->Save(a_intfc, kSoulTrap, kSerializationVersion)) {
-			logger::critical("Failed to save SoulTrap regs!"sv);
-		}
+	std::string DecodeTypeCode(std::uint32_t a_typeCode)
+	{
+		constexpr std::size_t SIZE = sizeof(std::uint32_t);
 
-		auto spellLearned = OnSpellsLearnedRegSet::GetSingleton();
-		if (!spellLearned->Save(a_intfc, kSpellLearned, kSerializationVersion)) {
-			logger::critical("Failed to save SpellLearned regs!"sv);
+		std::string sig;
+		sig.resize(SIZE);
+		char* iter = reinterpret_cast<char*>(&a_typeCode);
+		for (std::size_t i = 0, j = SIZE - 2; i < SIZE - 1; ++i, --j) {
+			sig[j] = iter[i];
 		}
+		return sig;
+	}
 
-		//hooked events
-		auto actorResurrect = OnActorResurrectRegSet::GetSingleton();
-		if (!actorResurrect->Save(a_intfc, kActorResurrect, kSerializationVersion)) {
-			logger::critical("Failed to save ActorResurrect regs!"sv);
-		}
 
-		auto actorReanimateStart = OnActorReanimateStartRegSet::GetSingleton();
-		if (!actorReanimateStart->Save(a_intfc, kActorReanimateStart, kSerializationVersion)) {
-			logger::critical("Failed to save ActorReanimateStart regs!"sv);
-		}
+	void SaveCallback(SKSE::SerializationInterface* a_intfc)
+	{
+		using namespace Form;
 
-		auto actorReanimateStop = OnActorReanimateStopRegSet::GetSingleton();
-		if (!actorReanimateStop->Save(a_intfc, kActorReanimateStop, kSerializationVersion)) {
-			logger::critical("Failed to save ActorReanimateStop regs!"sv);
-		}
+		auto telemetry = Telemetry::GetSingleton();
+		telemetry->Begin(Telemetry::MODE::kSave);
 
-		auto weatherChange = OnWeatherChangeRegSet::GetSingleton();
-		if (!weatherChange->Save(a_intfc, kWeatherChange, kSerializationVersion)) {
-			logger::critical("Failed to save WeatherChange regs!"sv);
-		}
+		//forms
+		auto perks = Perks::GetSingleton();
+		SaveForms(a_intfc, perks, kAddPerks, kAdd, "Add Perks"sv);
+		SaveForms(a_intfc, perks, kRemovePerks, kRemove, "Remove Perks"sv);
 
-		auto magicEffect = OnMagicEffectApplyRegMap::GetSingleton();
-		if (!magicEffect->Save(a_intfc, kMagicEffectApply, kSerializationVersion)) {
-			logger::critical("Failed to save Magic Effect Apply regs!"sv);
-		}
+		auto keywords = Keywords::GetSingleton();
+		SaveForms(a_intfc, keywords, kAddKeywords, kAdd, "Add Keywords"sv);
+		SaveForms(a_intfc, keywords, kRemoveKeywords, kRemove, "Remove Keywords"sv);
 
-		auto weaponHit = OnWeaponHitRegSet::GetSingleton();
-		if (!weaponHit->Save(a_intfc, kWeaponHit, kSerializationVersion)) {
-			logger::critical("Failed to save Weapon Hit Apply regs!"sv);
-		}
+		//events
+		ForEachRegistration([&](auto* a_regs) {
+			SaveRegs(a_intfc, a_regs);
+		});
+		SaveConditionalRegs(a_intfc);
 
-		auto magicHit = OnMagicHitRegSet::GetSingleton();
-		if (!magicHit->Save(a_intfc, kMagicHit, kSerializationVersion)) {
-			logger::critical("Failed to save Magic Hit Apply regs!"sv);
-		}
+		MemoryStats::LogReport();
 
-		auto projectileHit = OnProjectileHitRegSet::GetSingleton();
-		if (!projectileHit->Save(a_intfc, kProjectileHit, kSerializationVersion)) {
-			logger::critical("Failed to save Projectile Hit Apply regs!"sv);
-		}
+		telemetry->End();
+		logger::info("Finished saving data"sv);
+	}
 
-		//FEC events
-		auto actorEffectReset = OnFECResetRegMap::GetSingleton();
-		if (!actorEffectReset->Save(a_intfc, kFECReset, kSerializationVersion)) {
-			logger::critical("Failed to save FECReset regs!"sv);
-		}
 
-		logger::info("Finished saving data"sv);
+	void RevertCallback(SKSE::SerializationInterface*)
+	{
+		ForEachRegistration([](auto* a_regs) {
+			a_regs->Clear();
+		});
+		ForEachConditionalRegistration([](auto* a_regs) {
+			a_regs->Clear();
+		});
+
+		logger::info("Reverted registrations"sv);
 	}
 
 
 	void LoadCallback(SKSE::SerializationInterface* a_intfc)
 	{
 		using namespace Form;
-		using namespace ScriptEvents;
-		using namespace StoryEvents;
-		using namespace HookedEvents;
-		using namespace FECEvents;
+
+		auto telemetry = Telemetry::GetSingleton();
+		telemetry->Begin(Telemetry::MODE::kLoad);
 
 		auto perks = Perks::GetSingleton();
 		auto keywords = Keywords::GetSingleton();
@@ -231,314 +239,39 @@ namespace Serialization
 				continue;
 			}
 
+			telemetry->BeginRecord(type);
+
+			std::size_t entries = 0;
+			std::uint32_t unresolved = 0;
 			switch (type) {
 			case kAddPerks:
-				{
-					perks->Clear(Form::kAdd);
-					if (!perks->Load(a_intfc, Form::kAdd)) {
-						logger::critical("Failed to load AddPerks reg!"sv);
-					} else {
-						perks->LoadData(Form::kAdd);
-					}
-				}
+				entries = LoadForms(a_intfc, perks, kAdd, "AddPerks"sv, unresolved);
 				break;
 			case kRemovePerks:
-				{
-					perks->Clear(Form::kRemove);
-					if (!perks->Load(a_intfc, Form::kRemove)) {
-						logger::critical("Failed to load RemovePerks reg!"sv);
-					} else {
-						perks->LoadData(Form::kRemove);
-					}
-				}
+				entries = LoadForms(a_intfc, perks, kRemove, "RemovePerks"sv, unresolved);
 				break;
 			case kAddKeywords:
-				{
-					keywords->Clear(Form::kAdd);
-					if (!keywords->Load(a_intfc, Form::kAdd)) {
-						logger::critical("Failed to load AddKeywords reg!"sv);
-					} else {
-						keywords->LoadData(Form::kAdd);
-					}
-				}
+				entries = LoadForms(a_intfc, keywords, kAdd, "AddKeywords"sv, unresolved);
 				break;
 			case kRemoveKeywords:
-				{
-					keywords->Clear(Form::kRemove);
-					if (!keywords->Load(a_intfc, Form::kRemove)) {
-						logger::critical("Failed to load RemoveKeywords reg!"sv);
-					} else {
-						keywords->LoadData(Form::kRemove);
-					}
-				}
-				break;
-			case kOnCellFullyLoaded:
-				{
-					auto regs = OnCellFullyLoadedRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load OnCellFullyLoaded regs!"sv);
-					}
-				}
-				break;
-			case kQuestStart:
-				{
-					auto regs = OnQuestStartRegMap::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load QuestStart regs!"sv);
-					}
-				}
-				break;
-			case kQuestStop:
-				{
-					auto regs = OnQuestStopRegMap::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load QuestStop regs!"sv);
-					}
-				}
+				entries = LoadForms(a_intfc, keywords, kRemove, "RemoveKeywords"sv, unresolved);
 				break;
-			case kQuestStage:
-				{
-					auto regs = OnQuestStageRegMap::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load QuestStage regs!"sv);
-					}
-				}
-				break;
-			case kObjectLoaded:
-				{
-					auto regs = OnObjectLoadedRegMap::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load ObjectLoaded regs!"sv);
-					}
-				}
-				break;
-			case kObjectUnloaded:
-				{
-					auto regs = OnObjectUnloadedRegMap::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load ObjectUnloaded regs!"sv);
-					}
-				}
-				break;
-			case kGrab:
-				{
-					auto regs = OnGrabRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load ObjectGrab regs!"sv);
-					}
-				}
-				break;
-			case kRelease:
-				{
-					auto regs = OnReleaseRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load ObjectRelease regs!"sv);
-					}
-				}
-				break;
-			case kActorKill:
-				{
-					auto regs = OnActorKillRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load ActorKill regs!"sv);
-					}
-				}
-				break;
-			case kBookRead:
-				{
-					auto regs = OnBooksReadRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load BooksRead regs!"sv);
-					}
-				}
-				break;
-			case kCritHit:
-				{
-					auto regs = OnCriticalHitRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load CriticalHit regs!"sv);
-					}
-				}
-				break;
-			case kDisarm:
-				{
-					auto regs = OnDisarmedRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load Disarmed regs!"sv);
-					}
-				}
-				break;
-			case kDragonSoul:
-				{
-					auto regs = OnDragonSoulsGainedRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load DragonSoulsGained regs!"sv);
-					}
-				}
-				break;
-			case kHarvest:
-				{
-					auto regs = OnItemHarvestedRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load ItemHarvested regs!"sv);
-					}
-				}
-				break;
-			case kLevelIncrease:
-				{
-					auto regs = OnLevelIncreaseRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load CriticalHit regs!"sv);
-					}
-				}
-				break;
-			case kLocDiscovery:
-				{
-					auto regs = OnLocationDiscoveryRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load LocationDiscovery regs!"sv);
-					}
-				}
-				break;
-			case kShoutAttack:
-				{
-					auto regs = OnShoutAttackRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load ShoutAttack regs!"sv);
-					}
-				}
-				break;
-			case kSkillIncrease:
-				{
-					auto regs = OnSkillIncreaseRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load SkillIncrease regs!"sv);
-					}
-				}
-				break;
-			case kSoulTrap:
-				{
-					auto regs = OnSoulsTrappedRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load Soul Trap regs!"sv);
-					}
-				}
-				break;
-			case kSpellLearned:
-				{
-					auto regs = OnSpellsLearnedRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load SpellsLearned regs!"sv);
-					}
-				}
-				break;
-			case kActorResurrect:
-				{
-					auto regs = OnActorResurrectRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load ActorResurrect regs!"sv);
-					}
-				}
-				break;
-			case kActorReanimateStart:
-				{
-					auto regs = OnActorReanimateStartRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load ActorReanimateStart regs!"sv);
-					}
-				}
-				break;
-			case kActorReanimateStop:
-				{
-					auto regs = OnActorReanimateStopRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load ActorReanimateStop regs!"sv);
-					}
-				}
-				break;
-			case kWeatherChange:
-				{
-					auto regs = OnWeatherChangeRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load WeatherChange regs!"sv);
-					}
-				}
-				break;
-			case kMagicEffectApply:
-				{
-					auto regs = OnMagicEffectApplyRegMap::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load MagicEffectApply regs!"sv);
-					}
-				}
-				break;
-			case kWeaponHit:
-				{
-					auto regs = OnWeaponHitRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load Weapon Hit regs!"sv);
-					}
-				}
-				break;
-			case kMagicHit:
-				{
-					auto regs = OnMagicHitRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load Magic Hit regs!"sv);
-					}
-				}
-				break;
-			case kProjectileHit:
-				{
-					auto regs = OnProjectileHitRegSet::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load Projectile Hit regs!"sv);
-					}
-				}
-				break;
-			case kFECReset:
-				{
-					auto regs = OnFECResetRegMap::GetSingleton();
-					regs->Clear();
-					if (!regs->Load(a_intfc)) {
-						logger::critical("Failed to load FECReset regs!"sv);
-					}
-				}
+			case kConditionalEvents:
+				entries = LoadConditionalRegs(a_intfc);
 				break;
 			default:
-				logger::critical("Unrecognized record type ({})!"sv, DecodeTypeCode(type));
+				if (const auto regs = LoadRegs(a_intfc, type); regs) {
+					entries = *regs;
+				} else {
+					logger::critical("Unrecognized record type ({})!"sv, DecodeTypeCode(type));
+				}
 				break;
 			}
+
+			telemetry->EndRecord(entries, length, unresolved);
 		}
 
+		telemetry->End();
 		logger::info("Finished loading data"sv);
 	}
 }
@@ -0,0 +1,101 @@
+#include "Serialization/Telemetry.h"
+
+#include "Serialization/Manager.h"
+
+
+namespace Serialization
+{
+	namespace
+	{
+		std::string FormatBytes(const std::optional<std::uint64_t>& a_bytes)
+		{
+			return a_bytes ? std::to_string(*a_bytes) : std::string("?");
+		}
+	}
+
+
+	Telemetry* Telemetry::GetSingleton()
+	{
+		static Telemetry singleton;
+		return &singleton;
+	}
+
+
+	void Telemetry::Begin(MODE a_mode)
+	{
+		Locker locker(_lock);
+
+		_mode = a_mode;
+		_start = Clock::now();
+		GetRecords(a_mode).clear();
+	}
+
+
+	void Telemetry::BeginRecord(std::uint32_t a_type)
+	{
+		Locker locker(_lock);
+
+		_current = { a_type, 0, std::nullopt, 0, 0.0 };
+		_recordStart = Clock::now();
+	}
+
+
+	void Telemetry::EndRecord(std::size_t a_entries, std::optional<std::uint64_t> a_bytes, std::uint32_t a_unresolved)
+	{
+		Locker locker(_lock);
+
+		_current.entries = a_entries;
+		_current.bytes = a_bytes;
+		_current.unresolved = a_unresolved;
+		_current.time = std::chrono::duration<double, std::milli>(Clock::now() - _recordStart).count();
+
+		GetRecords(_mode).push_back(_current);
+	}
+
+
+	void Telemetry::End()
+	{
+		Locker locker(_lock);
+
+		const auto& records = GetRecords(_mode);
+
+		std::uint64_t totalBytes = 0;
+		std::uint32_t totalUnresolved = 0;
+		for (const auto& record : records) {
+			if (record.entries > 0 || record.unresolved > 0) {
+				logger::info("[{}] {} entries, {} bytes, {} unresolved, {:.3f} ms"sv, DecodeTypeCode(record.type), record.entries, FormatBytes(record.bytes), record.unresolved, record.time);
+			}
+			totalBytes += record.bytes.value_or(0);
+			totalUnresolved += record.unresolved;
+		}
+
+		//records without a known size are left out of the total
+		const auto time = std::chrono::duration<double, std::milli>(Clock::now() - _start).count();
+		logger::info("{} records, {} bytes, {} unresolved, {:.3f} ms"sv, records.size(), totalBytes, totalUnresolved, time);
+	}
+
+
+	std::vector<std::string> Telemetry::GetReport() const
+	{
+		Locker locker(_lock);
+
+		std::vector<std::string> report;
+		report.reserve(_save.size() + _load.size());
+
+		const auto append = [&](std::string_view a_mode, const std::vector<Record>& a_records) {
+			for (const auto& record : a_records) {
+				report.push_back(fmt::format("{} {} : {} entries, {} bytes, {} unresolved, {:.3f} ms", a_mode, DecodeTypeCode(record.type), record.entries, FormatBytes(record.bytes), record.unresolved, record.time));
+			}
+		};
+		append("Save"sv, _save);
+		append("Load"sv, _load);
+
+		return report;
+	}
+
+
+	std::vector<Telemetry::Record>& Telemetry::GetRecords(MODE a_mode)
+	{
+		return a_mode == MODE::kSave ? _save : _load;
+	}
+}
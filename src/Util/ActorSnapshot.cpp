@@ -0,0 +1,106 @@
+#include "Util/ActorSnapshot.h"
+
+#include "Util/Frame.h"
+
+
+namespace Actors
+{
+	namespace
+	{
+		std::mutex lock;
+		std::shared_ptr<const Snapshot> current;
+		std::uint64_t currentFrame{ 0 };
+	}
+
+
+	std::shared_ptr<const Snapshot> Snapshot::Get()
+	{
+		std::lock_guard locker(lock);
+
+		const auto frame = Frame::GetIndex();
+		if (!current || currentFrame != frame) {
+			auto next = std::make_shared<Snapshot>();
+			next->Build();
+			current = std::move(next);
+			currentFrame = frame;
+		}
+
+		return current;
+	}
+
+
+	void Snapshot::Invalidate()
+	{
+		std::lock_guard locker(lock);
+		current.reset();
+	}
+
+
+	bool Snapshot::MayHaveKeyword(std::size_t a_index, const RE::BGSKeyword* a_keyword) const
+	{
+		return (_signatures[a_index] & GetKeywordBit(a_keyword)) != 0;
+	}
+
+
+	std::uint64_t Snapshot::GetKeywordBit(const RE::BGSKeyword* a_keyword)
+	{
+		//top 6 bits of a multiplicative hash pick one of 64 bits
+		const auto hash = static_cast<std::uint64_t>(a_keyword->GetFormID()) * 0x9E3779B97F4A7C15;
+		return std::uint64_t(1) << (hash >> 58);
+	}
+
+
+	void Snapshot::Build()
+	{
+		if (const auto processLists = RE::ProcessLists::GetSingleton(); processLists) {
+			const std::array<RE::BSTArray<RE::ActorHandle>*, kTotal> handles{
+				&processLists->highActorHandles,
+				&processLists->middleHighActorHandles,
+				&processLists->middleLowActorHandles,
+				&processLists->lowActorHandles
+			};
+
+			for (std::uint32_t level = 0; level < kTotal; level++) {
+				auto& actors = _levels[level];
+				actors.reserve(handles[level]->size());
+				for (auto& actorHandle : *handles[level]) {
+					if (auto actorPtr = actorHandle.get(); actorPtr) {
+						actors.push_back(std::move(actorPtr));
+					}
+				}
+			}
+		}
+
+		for (const auto& actor : _levels[kHigh]) {
+			AddPosition(actor.get());
+		}
+		if (const auto player = RE::PlayerCharacter::GetSingleton(); player) {
+			AddPosition(player);
+		}
+		_positions.Finish();
+	}
+
+
+	void Snapshot::AddPosition(RE::Actor* a_actor)
+	{
+		std::uint64_t signature = 0;
+		const auto addKeywords = [&](const RE::TESForm* a_form) {
+			const auto keywordForm = a_form ? a_form->As<RE::BGSKeywordForm>() : nullptr;
+			if (!keywordForm || !keywordForm->keywords) {
+				return;
+			}
+			for (std::uint32_t i = 0; i < keywordForm->numKeywords; i++) {
+				if (const auto keyword = keywordForm->keywords[i]; keyword) {
+					signature |= GetKeywordBit(keyword);
+				}
+			}
+		};
+		addKeywords(a_actor->GetBaseObject());
+		addKeywords(a_actor->GetActorBase());
+		addKeywords(a_actor->GetRace());
+
+		_positions.Add(a_actor);
+		_names.push_back(a_actor->GetName());
+		_signatures.push_back(signature);
+	}
+}
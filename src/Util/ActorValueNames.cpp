@@ -0,0 +1,39 @@
+#include "Util/ActorValueNames.h"
+
+
+namespace ActorValueNames
+{
+	namespace
+	{
+		std::array<RE::BSFixedString, to_underlying(RE::ActorValue::kTotal)> names;
+	}
+
+
+	void Build()
+	{
+		const auto actorValueList = RE::ActorValueList::GetSingleton();
+		if (!actorValueList) {
+			logger::error("Failed to build actor value names"sv);
+			return;
+		}
+
+		std::size_t count = 0;
+		for (std::uint32_t i = 0; i < names.size(); i++) {
+			if (const auto info = actorValueList->GetActorValue(static_cast<RE::ActorValue>(i)); info && info->enumName) {
+				names[i] = info->enumName;
+				count++;
+			}
+		}
+
+		logger::info("Cached {} actor value names"sv, count);
+	}
+
+
+	const RE::BSFixedString& Get(RE::ActorValue a_actorValue)
+	{
+		static const RE::BSFixedString empty;
+
+		const auto index = static_cast<std::size_t>(to_underlying(a_actorValue));
+		return index < names.size() ? names[index] : empty;
+	}
+}
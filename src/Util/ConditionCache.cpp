@@ -0,0 +1,209 @@
+#include "Util/ConditionCache.h"
+
+
+namespace Condition
+{
+	Cache* Cache::GetSingleton()
+	{
+		static Cache singleton;
+		return &singleton;
+	}
+
+
+	RE::TESConditionItem* Cache::CreateChain(const std::vector<RE::BSFixedString>& a_conditionList)
+	{
+		Locker locker(_lock);
+		return CreateChain(GetEntry(a_conditionList).conditions);
+	}
+
+
+	RE::TESConditionItem* Cache::CreateChain(const ConditionDataVec& a_conditions)
+	{
+		RE::TESConditionItem* head = nullptr;
+
+		//prepended, so the chain runs from the last condition back to the first
+		for (const auto& condition : a_conditions) {
+			const auto item = new RE::TESConditionItem;
+			item->data = GetItemData(condition);
+			item->next = head;
+			head = item;
+		}
+
+		return head;
+	}
+
+
+	RE::TESConditionItem* Cache::CopyChain(const RE::TESConditionItem* a_head)
+	{
+		RE::TESConditionItem* head = nullptr;
+
+		//prepended, so the copy runs in reverse
+		for (auto item = a_head; item; item = item->next) {
+			const auto copy = new RE::TESConditionItem;
+			copy->data = item->data;
+			copy->next = head;
+			head = copy;
+		}
+
+		return head;
+	}
+
+
+	auto Cache::GetOrderedChain(const std::vector<RE::BSFixedString>& a_conditionList) -> Chain
+	{
+		Locker locker(_lock);
+		return GetEntry(a_conditionList).orderedChain;
+	}
+
+
+	std::vector<RE::BSFixedString> Cache::GetConditionList(const RE::TESCondition* a_conditions)
+	{
+		Locker locker(_lock);
+
+		auto [it, inserted] = _formatted.try_emplace(a_conditions);
+		auto& formatted = it->second;
+		if (inserted || formatted.head != a_conditions->head) {
+			formatted.head = a_conditions->head;
+			formatted.conditions = BuildConditions(a_conditions);
+		}
+
+		return formatted.conditions;
+	}
+
+
+	void Cache::Invalidate(const RE::TESCondition* a_conditions)
+	{
+		Locker locker(_lock);
+		_formatted.erase(a_conditions);
+	}
+
+
+	void Cache::Clear()
+	{
+		Locker locker(_lock);
+		_cache.clear();
+		_entries = 0;
+		_formatted.clear();
+	}
+
+
+	std::pair<std::size_t, std::size_t> Cache::GetMemoryUsage() const
+	{
+		Locker locker(_lock);
+
+		//list nodes (value + two links) and one pointer per bucket
+		std::size_t bytes = _cache.bucket_count() * sizeof(void*) + _formatted.bucket_count() * sizeof(void*);
+		for (const auto& [hash, bucket] : _cache) {
+			bytes += sizeof(std::pair<const std::uint64_t, std::vector<Entry>>) + 2 * sizeof(void*) + bucket.capacity() * sizeof(Entry);
+			for (const auto& entry : bucket) {
+				bytes += entry.key.capacity() * sizeof(RE::BSFixedString);
+				bytes += entry.conditions.capacity() * sizeof(ConditionData);
+				bytes += entry.conditions.size() * sizeof(RE::TESConditionItem);
+			}
+		}
+		for (const auto& [conditions, formatted] : _formatted) {
+			bytes += sizeof(std::pair<const RE::TESCondition* const, Formatted>) + 2 * sizeof(void*);
+			bytes += formatted.conditions.capacity() * sizeof(RE::BSFixedString);
+		}
+
+		return { _entries + _formatted.size(), bytes };
+	}
+
+
+	// caller holds _lock
+	auto Cache::GetEntry(const std::vector<RE::BSFixedString>& a_conditionList) -> const Entry&
+	{
+		const auto hash = Hash(a_conditionList);
+
+		if (const auto it = _cache.find(hash); it != _cache.end()) {
+			for (const auto& entry : it->second) {
+				if (IsMatch(entry.key, a_conditionList)) {
+					return entry;
+				}
+			}
+		}
+
+		//chains handed out stay alive with their owners, so starting over only costs a reparse
+		if (_entries >= MAX_ENTRIES) {
+			_cache.clear();
+			_entries = 0;
+		}
+
+		//failed lists are cached too, so malformed strings are only parsed once
+		auto conditions = ParseConditions(a_conditionList);
+		auto orderedChain = BuildChain(conditions.rbegin(), conditions.rend());
+
+		_entries++;
+		return _cache[hash].emplace_back(Entry{ a_conditionList, std::move(conditions), std::move(orderedChain) });
+	}
+
+
+	std::uint64_t Cache::Hash(const std::vector<RE::BSFixedString>& a_conditionList)
+	{
+		//FNV-1a, with the string terminator hashed as a separator
+		constexpr std::uint64_t prime = 0x100000001B3;
+
+		std::uint64_t hash = 0xCBF29CE484222325;
+		for (const auto& condition : a_conditionList) {
+			const std::string_view str(condition.c_str(), condition.size());
+			for (const auto ch : str) {
+				hash = (hash ^ static_cast<std::uint8_t>(ch)) * prime;
+			}
+			hash *= prime;
+		}
+		return hash;
+	}
+
+
+	bool Cache::IsMatch(const std::vector<RE::BSFixedString>& a_lhs, const std::vector<RE::BSFixedString>& a_rhs)
+	{
+		//BSFixedString compares case insensitively, the parser doesn't
+		return std::equal(a_lhs.begin(), a_lhs.end(), a_rhs.begin(), a_rhs.end(), [](const auto& a_l, const auto& a_r) {
+			return std::string_view(a_l.c_str(), a_l.size()) == std::string_view(a_r.c_str(), a_r.size());
+		});
+	}
+
+
+	RE::CONDITION_ITEM_DATA Cache::GetItemData(const ConditionData& a_condition)
+	{
+		const auto& [object, functionID, param1, param2, opCode, value, ANDOR] = a_condition;
+
+		RE::CONDITION_ITEM_DATA data;
+		data.object = object;
+		data.functionData.function = functionID;
+		data.functionData.params[0] = param1;
+		data.functionData.params[1] = param2;
+		data.flags.opCode = opCode;
+		data.comparisonValue.f = value;
+		data.flags.isOR = ANDOR;
+
+		return data;
+	}
+
+
+	template <class It>
+	auto Cache::BuildChain(It a_first, It a_last) -> Chain
+	{
+		RE::TESConditionItem* head = nullptr;
+
+		//nodes are prepended, so the chain runs from a_last back to a_first
+		for (auto it = a_first; it != a_last; ++it) {
+			const auto item = new RE::TESConditionItem;
+			item->data = GetItemData(*it);
+			item->next = head;
+			head = item;
+		}
+
+		return head ? Chain(head, DeleteChain) : Chain();
+	}
+
+
+	void Cache::DeleteChain(const RE::TESConditionItem* a_head)
+	{
+		for (auto item = a_head; item;) {
+			const auto next = item->next;
+			delete item;
+			item = next;
+		}
+	}
+}
@@ -0,0 +1,145 @@
+#include "Util/ConditionEvaluator.h"
+
+#include "Util/ConditionProfiler.h"
+
+
+namespace Condition
+{
+	namespace
+	{
+		bool IsItemTrue(const RE::TESConditionItem& a_item, RE::ConditionCheckParams& a_params, RE::TESObjectREFR* a_actionRef, RE::TESObjectREFR* a_target, Memo* a_memo)
+		{
+			const auto profiler = Profiler::GetSingleton();
+			const auto profile = profiler->IsEnabled();
+			const auto functionID = static_cast<std::uint32_t>(*a_item.data.functionData.function);
+
+			if (a_memo) {
+				if (const auto result = a_memo->Find(&a_item, a_actionRef, a_target); result) {
+					if (profile) {
+						profiler->RecordCachedFunction(functionID);
+					}
+					return *result;
+				}
+			}
+
+			bool result;
+			if (profile) {
+				const auto start = Profiler::Clock::now();
+				result = a_item.IsTrue(a_params);
+				profiler->RecordFunction(functionID, Profiler::Clock::now() - start);
+			} else {
+				result = a_item.IsTrue(a_params);
+			}
+			if (a_memo) {
+				a_memo->Insert(&a_item, a_actionRef, a_target, result);
+			}
+
+			return result;
+		}
+
+
+		// spells and magic effects, see IsTrue(const RE::TESForm&, ...)
+		bool IsFormTrue(const RE::TESForm& a_form, RE::TESObjectREFR* a_actionRef, RE::TESObjectREFR* a_target, Memo* a_memo)
+		{
+			switch (a_form.GetFormType()) {
+			case RE::FormType::Spell:
+			case RE::FormType::Enchantment:
+			case RE::FormType::Ingredient:
+			case RE::FormType::AlchemyItem:
+			case RE::FormType::Scroll:
+				{
+					const auto magicItem = a_form.As<RE::MagicItem>();
+					if (!magicItem) {
+						return false;
+					}
+					return std::any_of(magicItem->effects.begin(), magicItem->effects.end(), [&](const auto& a_effect) {
+						return a_effect && a_effect->baseEffect &&
+							   IsTrue(a_effect->conditions, a_actionRef, a_target, a_memo) &&
+							   IsTrue(a_effect->baseEffect->conditions, a_actionRef, a_target, a_memo);
+					});
+				}
+			case RE::FormType::MagicEffect:
+				{
+					const auto effect = a_form.As<RE::EffectSetting>();
+					return effect && IsTrue(effect->conditions, a_actionRef, a_target, a_memo);
+				}
+			default:
+				return true;
+			}
+		}
+	}
+
+
+	bool Memo::Key::operator==(const Key& a_rhs) const
+	{
+		return item == a_rhs.item && actionRef == a_rhs.actionRef && target == a_rhs.target;
+	}
+
+
+	std::size_t Memo::KeyHash::operator()(const Key& a_key) const
+	{
+		std::size_t seed = std::hash<const void*>()(a_key.item);
+		seed ^= std::hash<const void*>()(a_key.actionRef) + 0x9E3779B9 + (seed << 6) + (seed >> 2);
+		seed ^= std::hash<const void*>()(a_key.target) + 0x9E3779B9 + (seed << 6) + (seed >> 2);
+		return seed;
+	}
+
+
+	std::optional<bool> Memo::Find(const RE::TESConditionItem* a_item, const RE::TESObjectREFR* a_actionRef, const RE::TESObjectREFR* a_target) const
+	{
+		const auto it = _results.find({ a_item, a_actionRef, a_target });
+		return it != _results.end() ? std::optional<bool>(it->second) : std::nullopt;
+	}
+
+
+	void Memo::Insert(const RE::TESConditionItem* a_item, const RE::TESObjectREFR* a_actionRef, const RE::TESObjectREFR* a_target, bool a_result)
+	{
+		_results.insert_or_assign({ a_item, a_actionRef, a_target }, a_result);
+	}
+
+
+	bool IsTrue(const RE::TESConditionItem* a_head, RE::TESObjectREFR* a_actionRef, RE::TESObjectREFR* a_target, Memo* a_memo)
+	{
+		RE::ConditionCheckParams params(a_actionRef, a_target);
+
+		bool groupTrue = false;
+		bool groupOpen = false;
+
+		for (auto item = a_head; item; item = item->next) {
+			if (!groupTrue) {
+				groupTrue = IsItemTrue(*item, params, a_actionRef, a_target, a_memo);
+			}
+			groupOpen = item->data.flags.isOR;
+			if (!groupOpen) {
+				if (!groupTrue) {
+					return false;
+				}
+				groupTrue = false;
+			}
+		}
+
+		//a trailing OR item closes its group at the end of the list
+		return !groupOpen || groupTrue;
+	}
+
+
+	bool IsTrue(const RE::TESCondition& a_conditions, RE::TESObjectREFR* a_actionRef, RE::TESObjectREFR* a_target, Memo* a_memo)
+	{
+		return IsTrue(a_conditions.head, a_actionRef, a_target, a_memo);
+	}
+
+
+	bool IsTrue(const RE::TESForm& a_form, RE::TESObjectREFR* a_actionRef, RE::TESObjectREFR* a_target, Memo* a_memo)
+	{
+		const auto profiler = Profiler::GetSingleton();
+		if (!profiler->IsEnabled()) {
+			return IsFormTrue(a_form, a_actionRef, a_target, a_memo);
+		}
+
+		const auto start = Profiler::Clock::now();
+		const auto result = IsFormTrue(a_form, a_actionRef, a_target, a_memo);
+		profiler->RecordForm(&a_form, Profiler::Clock::now() - start);
+
+		return result;
+	}
+}
@@ -1,572 +1,125 @@
 #include "Util/ConditionParser.h"
 
+#include "Util/ActorValueNames.h"
+
+#include <charconv>
+
 
 namespace Condition
 {
-	using PARAM_TYPE = RE::SCRIPT_PARAM_TYPE;
-	using PARAMS = std::pair<std::optional<PARAM_TYPE>, std::optional<PARAM_TYPE>>;
+	namespace
+	{
+		constexpr std::array<std::string_view, 7> fieldNames{
+			"condition item object"sv,
+			"function ID"sv,
+			"param 1"sv,
+			"param 2"sv,
+			"opcode"sv,
+			"float"sv,
+			"AND/OR"sv
+		};
+
+
+		constexpr std::array<std::string_view, 4> statusNames{
+			"ok"sv,
+			"missing field"sv,
+			"invalid value"sv,
+			"unsupported value"sv
+		};
+
+
+		auto Trim(std::string_view a_str) -> std::string_view
+		{
+			constexpr auto whitespace = " \t\n\r\f\v"sv;
+
+			const auto first = a_str.find_first_not_of(whitespace);
+			if (first == std::string_view::npos) {
+				return {};
+			}
+			const auto last = a_str.find_last_not_of(whitespace);
+			return a_str.substr(first, last - first + 1);
+		}
 
 
-	auto GetFuncType(FUNC_ID a_funcID) -> PARAMS
-	{
-		PARAMS paramPair;
-
-		switch (a_funcID) {
-		case FUNC_ID::kGetWantBlocking:
-		case FUNC_ID::kGetLocked:
-		case FUNC_ID::kGetSecondsPassed:
-		case FUNC_ID::kGetCurrentTime:
-		case FUNC_ID::kGetScale:
-		case FUNC_ID::kIsMoving:
-		case FUNC_ID::kIsTurning:
-		case FUNC_ID::kGetDisabled:
-		case FUNC_ID::kGetDisease:
-		case FUNC_ID::kGetClothingValue:
-		case FUNC_ID::kGetDead:
-		case FUNC_ID::kGetGold:
-		case FUNC_ID::kGetSleeping:
-		case FUNC_ID::kGetTalkedToPC:
-		case FUNC_ID::kGetAlarmed:
-		case FUNC_ID::kIsRaining:
-		case FUNC_ID::kGetAttacked:
-		case FUNC_ID::kGetIsCreature:
-		case FUNC_ID::kGetLockLevel:
-		case FUNC_ID::kIsSnowing:
-		case FUNC_ID::kGetRandomPercent:
-		case FUNC_ID::kGetLevel:
-		case FUNC_ID::kIsRotating:
-		case FUNC_ID::kGetIsAlerted:
-		case FUNC_ID::kIsWeaponMagicOut:
-		case FUNC_ID::kIsTorchOut:
-		case FUNC_ID::kIsShieldOut:
-		case FUNC_ID::kIsFacingUp:
-		case FUNC_ID::kGetKnockedState:
-		case FUNC_ID::kGetWeaponAnimType:
-		case FUNC_ID::kGetCurrentAIPackage:
-		case FUNC_ID::kIsWaiting:
-		case FUNC_ID::kIsIdlePlaying:
-		case FUNC_ID::kIsIntimidatedByPlayer:
-		case FUNC_ID::kGetActorAggroRadiusViolated:
-		case FUNC_ID::kIsGreetingPlayer:
-		case FUNC_ID::kIsGuard:
-		case FUNC_ID::kHasBeenEaten:
-		case FUNC_ID::kGetStaminaPercentage:
-		case FUNC_ID::kSameFactionAsPC:
-		case FUNC_ID::kSameRaceAsPC:
-		case FUNC_ID::kSameSexAsPC:
-		case FUNC_ID::kIsTalking:
-		case FUNC_ID::kGetWalkSpeed:
-		case FUNC_ID::kGetCurrentAIProcedure:
-		case FUNC_ID::kGetTrespassWarningLevel:
-		case FUNC_ID::kIsTrespassing:
-		case FUNC_ID::kIsInMyOwnedCell:
-		case FUNC_ID::kGetWindSpeed:
-		case FUNC_ID::kGetCurrentWeatherPercent:
-		case FUNC_ID::kIsContinuingPackagePCNear:
-		case FUNC_ID::kCanHaveFlames:
-		case FUNC_ID::kHasFlames:
-		case FUNC_ID::kGetOpenState:
-		case FUNC_ID::kGetSitting:
-		case FUNC_ID::kGetDayOfWeek:
-		case FUNC_ID::kIsPCSleeping:
-		case FUNC_ID::kIsPCAMurderer:
-		case FUNC_ID::kIsSwimming:
-		case FUNC_ID::kGetAmountSoldStolen:
-		case FUNC_ID::kGetIgnoreCrime:
-		case FUNC_ID::kGetDestroyed:
-		case FUNC_ID::kGetDefaultOpen:
-		case FUNC_ID::kGetAnimAction:
-		case FUNC_ID::kGetVATSMode:
-		case FUNC_ID::kGetPersuasionNumber:
-		case FUNC_ID::kGetVampireFeed:
-		case FUNC_ID::kGetCannibal:
-		case FUNC_ID::kGetClassDefaultMatch:
-		case FUNC_ID::kGetVatsTargetHeight:
-		case FUNC_ID::kGetIsGhost:
-		case FUNC_ID::kGetUnconscious:
-		case FUNC_ID::kGetRestrained:
-		case FUNC_ID::kIsInDialogueWithPlayer:
-		case FUNC_ID::kGetIsPlayableRace:
-		case FUNC_ID::kGetOffersServicesNow:
-		case FUNC_ID::kIsWeaponOut:
-		case FUNC_ID::kIsTimePassing:
-		case FUNC_ID::kIsPleasant:
-		case FUNC_ID::kIsCloudy:
-		case FUNC_ID::kIsSmallBump:
-		case FUNC_ID::kIsHorseStolen:
-		case FUNC_ID::kIsLeftUp:
-		case FUNC_ID::kIsSneaking:
-		case FUNC_ID::kIsRunning:
-		case FUNC_ID::kGetFriendHit:
-		case FUNC_ID::kIsInInterior:
-		case FUNC_ID::kIsWaterObject:
-		case FUNC_ID::kGetPlayerAction:
-		case FUNC_ID::kIsActorUsingATorch:
-		case FUNC_ID::kIsXBox:
-		case FUNC_ID::kGetPairedAnimation:
-		case FUNC_ID::kIsActorAVictim:
-		case FUNC_ID::kGetTotalPersuasionNumber:
-		case FUNC_ID::kGetIdleDoneOnce:
-		case FUNC_ID::kGetNoRumors:
-		case FUNC_ID::kGetCombatState:
-		case FUNC_ID::kIsRidingMount:
-		case FUNC_ID::kIsFleeing:
-		case FUNC_ID::kIsInDangerousWater:
-		case FUNC_ID::kGetIgnoreFriendlyHits:
-		case FUNC_ID::kIsPlayersLastRiddenMount:
-		case FUNC_ID::kIsActor:
-		case FUNC_ID::kIsEssential:
-		case FUNC_ID::kIsPlayerMovingIntoNewSpace:
-		case FUNC_ID::kGetTimeDead:
-		case FUNC_ID::kIsChild:
-		case FUNC_ID::kGetLastPlayerAction:
-		case FUNC_ID::kGetCrimeGoldViolent:
-		case FUNC_ID::kGetCrimeGoldNonviolent:
-		case FUNC_ID::kGetHitLocation:
-		case FUNC_ID::kIsPC1stPerson:
-		case FUNC_ID::kGetCauseofDeath:
-		case FUNC_ID::kIsBribedbyPlayer:
-		case FUNC_ID::kGetGroupMemberCount:
-		case FUNC_ID::kGetGroupTargetCount:
-		case FUNC_ID::kGetPlantedExplosive:
-		case FUNC_ID::kIsScenePackageRunning:
-		case FUNC_ID::kGetHealthPercentage:
-		case FUNC_ID::kGetDialogueEmotion:
-		case FUNC_ID::kGetDialogueEmotionValue:
-		case FUNC_ID::kGetPlayerTeammate:
-		case FUNC_ID::kGetPlayerTeammateCount:
-		case FUNC_ID::kGetActorCrimePlayerEnemy:
-		case FUNC_ID::kGetCrimeGold:
-		case FUNC_ID::kGetDestructionStage:
-		case FUNC_ID::kIsProtected:
-		case FUNC_ID::kIsCarryable:
-		case FUNC_ID::kGetConcussed:
-		case FUNC_ID::kGetMapMarkerVisible:
-		case FUNC_ID::kGetKillingBlowLimb:
-		case FUNC_ID::kCanPayCrimeGold:
-		case FUNC_ID::kGetDaysInJail:
-		case FUNC_ID::kEPAlchemyGetMakingPoison:
-		case FUNC_ID::kGetAllowWorldInteractions:
-		case FUNC_ID::kGetLastHitCritical:
-		case FUNC_ID::kGetIsLockBroken:
-		case FUNC_ID::kIsPS3:
-		case FUNC_ID::kIsWin32:
-		case FUNC_ID::kGetXPForNextLevel:
-		case FUNC_ID::kGetInfamy:
-		case FUNC_ID::kGetInfamyViolent:
-		case FUNC_ID::kGetInfamyNonViolent:
-		case FUNC_ID::kIsGoreDisabled:
-		case FUNC_ID::kGetActorsInHigh:
-		case FUNC_ID::kHasLoaded3D:
-		case FUNC_ID::kIsSprinting:
-		case FUNC_ID::kIsBlocking:
-		case FUNC_ID::kGetAttackState:
-		case FUNC_ID::kIsBleedingOut:
-		case FUNC_ID::kGetMovementDirection:
-		case FUNC_ID::kIsInScene:
-		case FUNC_ID::kGetIsFlying:
-		case FUNC_ID::kGetHighestRelationshipRank:
-		case FUNC_ID::kGetLowestRelationshipRank:
-		case FUNC_ID::kHasFamilyRelationshipAny:
-		case FUNC_ID::kGetPathingTargetSpeed:
-		case FUNC_ID::kGetMovementSpeed:
-		case FUNC_ID::kIsDualCasting:
-		case FUNC_ID::kIsEnteringInteractionQuick:
-		case FUNC_ID::kIsCasting:
-		case FUNC_ID::kGetFlyingState:
-		case FUNC_ID::kIsInFavorState:
-		case FUNC_ID::kHasTwoHandedWeaponEquipped:
-		case FUNC_ID::kIsExitingInstant:
-		case FUNC_ID::kIsInFriendStateWithPlayer:
-		case FUNC_ID::kIsUnique:
-		case FUNC_ID::kGetLastBumpDirection:
-		case FUNC_ID::kGetIsInjured:
-		case FUNC_ID::kGetIsCrashLandRequest:
-		case FUNC_ID::kGetIsHastyLandRequest:
-		case FUNC_ID::kGetBribeSuccess:
-		case FUNC_ID::kGetIntimidateSuccess:
-		case FUNC_ID::kGetArrestedState:
-		case FUNC_ID::kGetArrestingActor:
-		case FUNC_ID::kEPTemperingItemIsEnchanted:
-		case FUNC_ID::kIsAttacking:
-		case FUNC_ID::kIsPowerAttacking:
-		case FUNC_ID::kIsLastHostileActor:
-		case FUNC_ID::kGetCurrentShoutVariation:
-		case FUNC_ID::kGetActivationHeight:
-		case FUNC_ID::kGetPathingCurrentSpeed:
-		case FUNC_ID::kGetNoBleedoutRecovery:
-		case FUNC_ID::kIsAllowedToFly:
-		case FUNC_ID::kIsCommandedActor:
-		case FUNC_ID::kIsStaggered:
-		case FUNC_ID::kIsRecoiling:
-		case FUNC_ID::kIsExitingInteractionQuick:
-		case FUNC_ID::kIsPathing:
-		case FUNC_ID::kGetCombatGroupMemberCount:
-		case FUNC_ID::kIsIgnoringCombat:
-		case FUNC_ID::kGetLightLevel:
-		case FUNC_ID::kIsBeingRidden:
-		case FUNC_ID::kIsUndead:
-		case FUNC_ID::kGetRealHoursPassed:
-		case FUNC_ID::kIsUnlockedDoor:
-		case FUNC_ID::kIsPoison:
-		case FUNC_ID::kGetItemHealthPercent:
-		case FUNC_ID::kEffectWasDualCast:
-		case FUNC_ID::kGetKnockStateEnum:
-		case FUNC_ID::kDoesNotExist:
-		case FUNC_ID::kIsOnFlyingMount:
-		case FUNC_ID::kCanFlyHere:
-		case FUNC_ID::kIsFlyingMountPatrolQueued:
-		case FUNC_ID::kIsFlyingMountFastTravelling:
-		case FUNC_ID::kIsOverEncumbered:
-		case FUNC_ID::kGetActorWarmth:
-			paramPair = { std::nullopt, std::nullopt };
-			break;
-		case FUNC_ID::kGetDistance:
-		case FUNC_ID::kGetLineOfSight:
-		case FUNC_ID::kGetInSameCell:
-		case FUNC_ID::kGetHeadingAngle:
-		case FUNC_ID::kGetIsReference:
-		case FUNC_ID::kIsCurrentFurnitureRef:
-		case FUNC_ID::kGetRelationshipRank:
-		case FUNC_ID::kExists:
-		case FUNC_ID::kIsPlayerGrabbedRef:
-		case FUNC_ID::kGetVATSRightAreaFree:
-		case FUNC_ID::kGetVATSLeftAreaFree:
-		case FUNC_ID::kGetVATSBackAreaFree:
-		case FUNC_ID::kGetVATSFrontAreaFree:
-		case FUNC_ID::kGetVATSRightTargetVisible:
-		case FUNC_ID::kGetVATSLeftTargetVisible:
-		case FUNC_ID::kGetVATSBackTargetVisible:
-		case FUNC_ID::kGetVATSFrontTargetVisible:
-		case FUNC_ID::kGetInContainer:
-		case FUNC_ID::kGetInSharedCrimeFaction:
-		case FUNC_ID::kGetTargetHeight:
-			paramPair = { PARAM_TYPE::kObjectRef, std::nullopt };
-			break;
-		case FUNC_ID::kGetPos:
-		case FUNC_ID::kGetAngle:
-		case FUNC_ID::kGetStartingPos:
-		case FUNC_ID::kGetStartingAngle:
-		case FUNC_ID::kGetVelocity:
-		case FUNC_ID::kGetPathingTargetOffset:
-		case FUNC_ID::kGetPathingTargetAngleOffset:
-		case FUNC_ID::kGetPathingTargetSpeedAngle:
-		case FUNC_ID::kGetPathingCurrentSpeedAngle:
-			paramPair = { PARAM_TYPE::kAxis, std::nullopt };
-			break;
-		case FUNC_ID::kGetActorValue:
-		case FUNC_ID::kIsWeaponSkillType:
-		case FUNC_ID::kGetBaseActorValue:
-		case FUNC_ID::kGetPermanentActorValue:
-		case FUNC_ID::kGetActorValuePercent:
-		case FUNC_ID::kEPModSkillUsage_IsAdvanceSkill:
-		case FUNC_ID::kEPMagic_SpellHasSkill:
-			paramPair = { PARAM_TYPE::kActorValue, std::nullopt };
-			break;
-		case FUNC_ID::kMenuMode:
-		case FUNC_ID::kIsInCombat:
-		case FUNC_ID::kIsPlayerActionActive:
-		case FUNC_ID::kGetHasNote:
-		case FUNC_ID::kIsLimbGone:
-		case FUNC_ID::kGetIsCreatureType:
-		case FUNC_ID::kGetNumericPackageData:
-			paramPair = { PARAM_TYPE::kInt, std::nullopt };
-			break;
-		case FUNC_ID::kSameFaction:
-		case FUNC_ID::kSameRace:
-		case FUNC_ID::kSameSex:
-		case FUNC_ID::kGetDetected:
-		case FUNC_ID::kGetShouldAttack:
-		case FUNC_ID::kGetTalkedToPCParam:
-		case FUNC_ID::kHasFamilyRelationship:
-		case FUNC_ID::kHasParentRelationship:
-		case FUNC_ID::kIsTalkingActivatorActor:
-		case FUNC_ID::kIsKiller:
-		case FUNC_ID::kGetFactionRelation:
-		case FUNC_ID::kGetThreatRatio:
-		case FUNC_ID::kIsCombatTarget:
-		case FUNC_ID::kShouldAttackKill:
-		case FUNC_ID::kGetShouldHelp:
-		case FUNC_ID::kIsHostileToActor:
-			paramPair = { PARAM_TYPE::kActor, std::nullopt };
-			break;
-		case FUNC_ID::kGetItemCount:
-		case FUNC_ID::kGetEquipped:
-			paramPair = { PARAM_TYPE::kInvObjectOrFormList, std::nullopt };
-			break;
-		case FUNC_ID::kGetScriptVariable:
-		case FUNC_ID::kGetVMScriptVariable:
-			paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kChar };
-			break;
-		case FUNC_ID::kGetQuestRunning:
-		case FUNC_ID::kGetStage:
-		case FUNC_ID::kGetQuestCompleted:
-			paramPair = { PARAM_TYPE::kQuest, std::nullopt };
-			break;
-		case FUNC_ID::kGetStageDone:
-			paramPair = { PARAM_TYPE::kQuest, PARAM_TYPE::kInt };
-			break;
-		case FUNC_ID::kGetFactionRankDifference:
-			paramPair = { PARAM_TYPE::kFaction, PARAM_TYPE::kActor };
-			break;
-		case FUNC_ID::kGetInCell:
-			paramPair = { PARAM_TYPE::kCell, std::nullopt };
-			break;
-		case FUNC_ID::kGetIsClass:
-		case FUNC_ID::kGetPCIsClass:
-		case FUNC_ID::kGetIsClassDefault:
-			paramPair = { PARAM_TYPE::kClass, std::nullopt };
-			break;
-		case FUNC_ID::kGetIsRace:
-		case FUNC_ID::kGetPCIsRace:
-			paramPair = { PARAM_TYPE::kRace, std::nullopt };
-			break;
-		case FUNC_ID::kGetIsSex:
-		case FUNC_ID::kGetPCIsSex:
-			paramPair = { PARAM_TYPE::kSex, std::nullopt };
-			break;
-		case FUNC_ID::kGetInFaction:
-		case FUNC_ID::kGetFactionRank:
-		case FUNC_ID::kGetPCInFaction:
-		case FUNC_ID::kGetIsCrimeFaction:
-		case FUNC_ID::kGetPCExpelled:
-		case FUNC_ID::kGetPCFactionMurder:
-		case FUNC_ID::kGetPCEnemyofFaction:
-		case FUNC_ID::kGetPCFactionAttack:
-		case FUNC_ID::kGetStolenItemValueNoCrime:
-		case FUNC_ID::kGetStolenItemValue:
-			paramPair = { PARAM_TYPE::kFaction, std::nullopt };
-			break;
-		case FUNC_ID::kGetIsID:
-		case FUNC_ID::kGetIsUsedItem:
-			paramPair = { PARAM_TYPE::kObjectOrFormList, std::nullopt };
-			break;
-		case FUNC_ID::kGetGlobalValue:
-			paramPair = { PARAM_TYPE::kGlobal, std::nullopt };
-			break;
-		case FUNC_ID::kGetQuestVariable:
-		case FUNC_ID::kGetVMQuestVariable:
-			paramPair = { PARAM_TYPE::kQuest, PARAM_TYPE::kChar };
-			break;
-		case FUNC_ID::kGetDeadCount:
-			paramPair = { PARAM_TYPE::kActorBase, std::nullopt };
-			break;
-		case FUNC_ID::kGetPlayerControlsDisabled:
-			paramPair = { PARAM_TYPE::kInt, PARAM_TYPE::kInt };
-			break;
-		case FUNC_ID::kIsPlayerInRegion:
-			paramPair = { PARAM_TYPE::kRegion, std::nullopt };
-			break;
-		case FUNC_ID::kGetCrime:
-			paramPair = { PARAM_TYPE::kActor, PARAM_TYPE::kCrimeType };
-			break;
-		case FUNC_ID::kGetIsCurrentWeather:
-			paramPair = { PARAM_TYPE::kWeather, std::nullopt };
-			break;
-		case FUNC_ID::kGetIsCurrentPackage:
-			paramPair = { PARAM_TYPE::kPackage, std::nullopt };
-			break;
-		case FUNC_ID::kIsCurrentFurnitureObj:
-			paramPair = { PARAM_TYPE::kFurnitureOrFormList, std::nullopt };
-			break;
-		case FUNC_ID::kHasSameEditorLocAsRef:
-		case FUNC_ID::kIsInSameCurrentLocAsRef:
-		case FUNC_ID::kIsLinkedTo:
-			paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kKeyword };
-			break;
-		case FUNC_ID::kHasSameEditorLocAsRefAlias:
-		case FUNC_ID::kIsInSameCurrentLocAsRefAlias:
-		case FUNC_ID::kGetKeywordDataForAlias:
-		case FUNC_ID::kLocAliasHasKeyword:
-			paramPair = { PARAM_TYPE::kAlias, PARAM_TYPE::kKeyword };
-			break;
-		case FUNC_ID::kHasMagicEffect:
-			paramPair = { PARAM_TYPE::kMagicEffect, std::nullopt };
-			break;
-		case FUNC_ID::kIsSpellTarget:
-		case FUNC_ID::kHasSpell:
-		case FUNC_ID::kGetSpellUsageNum:
-			paramPair = { PARAM_TYPE::kMagicItem, std::nullopt };
-			break;
-		case FUNC_ID::kGetInCellParam:
-			paramPair = { PARAM_TYPE::kCell, PARAM_TYPE::kObjectRef };
-			break;
-		case FUNC_ID::kGetIsUsedItemType:
-		case FUNC_ID::kGetIsObjectType:
-			paramPair = { PARAM_TYPE::kFormType, std::nullopt };
-			break;
-		case FUNC_ID::kIsScenePlaying:
-			paramPair = { PARAM_TYPE::kBGSScene, std::nullopt };
-			break;
-		case FUNC_ID::kGetLocationCleared:
-		case FUNC_ID::kGetInCurrentLoc:
-		case FUNC_ID::kGetIsEditorLocation:
-		case FUNC_ID::kIsLocationLoaded:
-			paramPair = { PARAM_TYPE::kLocation, std::nullopt };
-			break;
-		case FUNC_ID::kHasAssociationType:
-			paramPair = { PARAM_TYPE::kActor, PARAM_TYPE::kAssociationType };
-			break;
-		case FUNC_ID::kIsWarningAbout:
-		case FUNC_ID::kIsInList:
-		case FUNC_ID::kIsWeaponInList:
-		case FUNC_ID::kIsKillerObject:
-		case FUNC_ID::kGetInCurrentLocFormList:
-			paramPair = { PARAM_TYPE::kFormList, std::nullopt };
-			break;
-		case FUNC_ID::kIsOwner:
-			paramPair = { PARAM_TYPE::kOwner, std::nullopt };
-			break;
-		case FUNC_ID::kIsCellOwner:
-			paramPair = { PARAM_TYPE::kCell, PARAM_TYPE::kOwner };
-			break;
-		case FUNC_ID::kGetInWorldspace:
-			paramPair = { PARAM_TYPE::kWorldOrList, std::nullopt };
-			break;
-		case FUNC_ID::kGetPCMiscStat:
-			paramPair = { PARAM_TYPE::kMiscStat, std::nullopt };
-			break;
-		case FUNC_ID::kGetWithinPackageLocation:
-		case FUNC_ID::kIsNullPackageData:
-			paramPair = { PARAM_TYPE::kPackageDataCanBeNull, std::nullopt };
-			break;
-		case FUNC_ID::kGetInCurrentLocAlias:
-		case FUNC_ID::kGetIsAliasRef:
-		case FUNC_ID::kGetIsEditorLocAlias:
-		case FUNC_ID::kGetLocationAliasCleared:
-		case FUNC_ID::kIsLocAliasLoaded:
-			paramPair = { PARAM_TYPE::kAlias, std::nullopt };
-			break;
-		case FUNC_ID::kHasLinkedRef:
-		case FUNC_ID::kGetKeywordItemCount:
-		case FUNC_ID::kEPAlchemyEffectHasKeyword:
-		case FUNC_ID::kHasKeyword:
-		case FUNC_ID::kLocationHasKeyword:
-		case FUNC_ID::kGetKeywordDataForCurrentLocation:
-		case FUNC_ID::kEPTemperingItemHasKeyword:
-		case FUNC_ID::kWornHasKeyword:
-		case FUNC_ID::kEPModSkillUsage_AdvanceObjectHasKeyword:
-		case FUNC_ID::kEPMagic_SpellHasKeyword:
-		case FUNC_ID::kIsAttackType:
-		case FUNC_ID::kHasMagicEffectKeyword:
-		case FUNC_ID::kGetCombatTargetHasKeyword:
-		case FUNC_ID::kWornApparelHasKeywordCount:
-			paramPair = { PARAM_TYPE::kKeyword, std::nullopt };
-			break;
-		case FUNC_ID::kHasShout:
-		case FUNC_ID::kGetEquippedShout:
-			paramPair = { PARAM_TYPE::kShout, std::nullopt };
-			break;
-		case FUNC_ID::kGetVATSValue:
-			paramPair = { PARAM_TYPE::kInt, PARAM_TYPE::kInt };
-			break;
-		case FUNC_ID::kGetFactionCombatReaction:
-			paramPair = { PARAM_TYPE::kFaction, PARAM_TYPE::kFaction };
-			break;
-		case FUNC_ID::kGetIsVoiceType:
-			paramPair = { PARAM_TYPE::kVoiceType, std::nullopt };
-			break;
-		case FUNC_ID::kGetInZone:
-			paramPair = { PARAM_TYPE::kEncounterZone, std::nullopt };
-			break;
-		case FUNC_ID::kGetGraphVariableFloat:
-		case FUNC_ID::kGetGraphVariableInt:
-			paramPair = { PARAM_TYPE::kChar, std::nullopt };
-			break;
-		case FUNC_ID::kHasPerk:
-			paramPair = { PARAM_TYPE::kPerk, PARAM_TYPE::kInt };
-			break;
-		case FUNC_ID::kIsLastIdlePlayed:
-			paramPair = { PARAM_TYPE::kIdleForm, std::nullopt };
-			break;
-		case FUNC_ID::kGetIsAlignment:
-			paramPair = { PARAM_TYPE::kAlignment, std::nullopt };
-			break;
-		case FUNC_ID::kGetIsUsedItemEquipType:
-			paramPair = { PARAM_TYPE::kEquipType, std::nullopt };
-			break;
-		case FUNC_ID::kPlayerKnows:
-			paramPair = { PARAM_TYPE::kKnowableForm, std::nullopt };
-			break;
-		case FUNC_ID::kIsInCriticalStage:
-			paramPair = { PARAM_TYPE::kCritStage, std::nullopt };
-			break;
-		case FUNC_ID::kIsSceneActionComplete:
-			paramPair = { PARAM_TYPE::kBGSScene, PARAM_TYPE::kInt };
-			break;
-		case FUNC_ID::kHasRefType:
-		case FUNC_ID::kLocationHasRefType:
-			paramPair = { PARAM_TYPE::kRefType, std::nullopt };
-			break;
-		case FUNC_ID::kHasEquippedSpell:
-		case FUNC_ID::kGetCurrentCastingType:
-		case FUNC_ID::kGetCurrentDeliveryType:
-		case FUNC_ID::kGetEquippedItemType:
-		case FUNC_ID::kGetReplacedItemType:
-		case FUNC_ID::kHasBoundWeaponEquipped:
-			paramPair = { PARAM_TYPE::kCastingSource, std::nullopt };
-			break;
-		case FUNC_ID::kGetEventData:
-			paramPair = { PARAM_TYPE::kEventFunction, PARAM_TYPE::kEventFunctionData };  // third parameter in xEdit but who cares, we're skipping this
-			break;
-		case FUNC_ID::kIsCloserToAThanB:
-			paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kObjectRef };
-			break;
-		case FUNC_ID::kGetRelativeAngle:
-			paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kAxis };
-			break;
-		case FUNC_ID::kGetRefTypeDeadCount:
-		case FUNC_ID::kGetRefTypeAliveCount:
-			paramPair = { PARAM_TYPE::kLocation, PARAM_TYPE::kRefType };
-			break;
-		case FUNC_ID::kIsCurrentSpell:
-			paramPair = { PARAM_TYPE::kMagicItem, PARAM_TYPE::kCastingSource };
-			break;
-		case FUNC_ID::kSpellHasKeyword:
-			paramPair = { PARAM_TYPE::kCastingSource, PARAM_TYPE::kKeyword };
-			break;
-		case FUNC_ID::kGetLocAliasRefTypeDeadCount:
-		case FUNC_ID::kGetLocAliasRefTypeAliveCount:
-			paramPair = { PARAM_TYPE::kAlias, PARAM_TYPE::kRefType };
-			break;
-		case FUNC_ID::kIsWardState:
-			paramPair = { PARAM_TYPE::kWardState, std::nullopt };
-			break;
-		case FUNC_ID::kLocAliasIsLocation:
-			paramPair = { PARAM_TYPE::kAlias, PARAM_TYPE::kLocation };
-			break;
-		case FUNC_ID::kGetKeywordDataForLocation:
-			paramPair = { PARAM_TYPE::kLocation, PARAM_TYPE::kKeyword };
-			break;
-		case FUNC_ID::kIsFurnitureAnimType:
-		case FUNC_ID::kIsInFurnitureState:
-			paramPair = { PARAM_TYPE::kFurnitureAnimType, std::nullopt };
-			break;
-		case FUNC_ID::kIsFurnitureEntryType:
-			paramPair = { PARAM_TYPE::kFurnitureEntryType, std::nullopt };
-			break;
-		case FUNC_ID::kHasAssociationTypeAny:
-			paramPair = { PARAM_TYPE::kAssociationType, std::nullopt };
-			break;
-		case FUNC_ID::kGetWithinDistance:
-			paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kFloat };
-			break;
-		case FUNC_ID::kEPModSkillUsage_IsAdvanceAction:
-			paramPair = { PARAM_TYPE::kSkillAction, std::nullopt };
-			break;
-		case FUNC_ID::kSpellHasCastingPerk:
-			paramPair = { PARAM_TYPE::kPerk, std::nullopt };
-			break;
-		default:
-			paramPair = { std::nullopt, std::nullopt };
-			break;
+		// splits into trimmed views over a_str, returns the number of fields written
+		template <std::size_t N>
+		auto Split(std::string_view a_str, char a_delim, std::array<std::string_view, N>& a_fields) -> std::size_t
+		{
+			std::size_t count = 0;
+			while (count < N) {
+				const auto pos = a_str.find(a_delim);
+				a_fields[count++] = Trim(a_str.substr(0, pos));
+				if (pos == std::string_view::npos) {
+					break;
+				}
+				a_str.remove_prefix(pos + 1);
+			}
+			return count;
 		}
 
-		return paramPair;
+
+		auto ToUInt(std::string_view a_str, int a_base = 10) -> std::optional<std::uint32_t>
+		{
+			std::uint32_t value = 0;
+			const auto end = a_str.data() + a_str.size();
+			const auto [ptr, ec] = std::from_chars(a_str.data(), end, value, a_base);
+			if (ec != std::errc() || ptr != end) {
+				return std::nullopt;
+			}
+			return value;
+		}
+
+
+		// matches std::stof : leading '+' and trailing characters are accepted
+		auto ToFloat(std::string_view a_str) -> std::optional<float>
+		{
+			if (!a_str.empty() && a_str.front() == '+') {
+				a_str.remove_prefix(1);
+			}
+			float value = 0.0f;
+			const auto [ptr, ec] = std::from_chars(a_str.data(), a_str.data() + a_str.size(), value);
+			if (ec != std::errc() || ptr == a_str.data()) {
+				return std::nullopt;
+			}
+			return value;
+		}
+
+
+		// fields are either the raw index or the name used by the game
+		template <class Map>
+		auto ToIndex(const Map& a_map, std::string_view a_str) -> std::optional<std::uint32_t>
+		{
+			if (const auto value = ToUInt(a_str); value) {
+				return value;
+			}
+			const auto it = a_map.find(frozen::string(a_str.data(), a_str.size()));
+			if (it == a_map.end()) {
+				return std::nullopt;
+			}
+			return it->second;
+		}
+
+
+		void Append(fmt::memory_buffer& a_buffer, std::string_view a_str)
+		{
+			a_buffer.append(a_str.data(), a_str.data() + a_str.size());
+		}
+
+
+		// writes the name from a_map, or the raw index if there is none
+		template <class Map>
+		void AppendName(fmt::memory_buffer& a_buffer, const Map& a_map, std::uint32_t a_index)
+		{
+			if (const auto it = a_map.find(a_index); it != a_map.end()) {
+				Append(a_buffer, std::string_view(it->second.data(), it->second.size()));
+			} else {
+				fmt::format_to(std::back_inserter(a_buffer), "{}", a_index);
+			}
+		}
 	}
 
 
-	auto ParseVoidParams(const std::string& a_str, void*& a_param, std::optional<PARAM_TYPE> a_type) -> bool
+	auto ParseVoidParams(std::string_view a_str, void*& a_param, std::optional<PARAM_TYPE> a_type) -> bool
 	{
 		bool result = false;
 
@@ -578,16 +131,13 @@ namespace Condition
 		case PARAM_TYPE::kObjectRef:
 		case PARAM_TYPE::kActor:
 			{
-				if (a_str.find("Player") != std::string::npos) {
+				if (a_str.find("Player"sv) != std::string_view::npos) {
 					a_param = RE::PlayerCharacter::GetSingleton();
 					result = true;
 				} else {
-					if (STRING::is_only_digit(a_str)) {
-						const auto formID = std::stoul(a_str);
-						if (formID == 14) {
-							a_param = RE::PlayerCharacter::GetSingleton();
-							result = true;
-						}
+					if (const auto formID = ToUInt(a_str); formID && *formID == 14) {
+						a_param = RE::PlayerCharacter::GetSingleton();
+						result = true;
 					}
 				}
 			}
@@ -624,14 +174,23 @@ namespace Condition
 		case PARAM_TYPE::kBGSScene:
 		case PARAM_TYPE::kKnowableForm:
 			{
-				auto split_param = STRING::split(a_str, " ~ ");
+				//only the first '~' separates, plugin names may contain more
+				const auto pos = a_str.find('~');
+				if (pos == std::string_view::npos) {
+					break;
+				}
+				const std::array<std::string_view, 2> split_param{ Trim(a_str.substr(0, pos)), Trim(a_str.substr(pos + 1)) };
 
-				const auto formID = std::stoul(split_param.at(kFormID), nullptr, 16);
-				const auto esp = split_param.at(kESP);
+				auto hex = split_param[kFormID];
+				if (hex.size() > 1 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X')) {
+					hex.remove_prefix(2);
+				}
+				const auto formID = ToUInt(hex, 16);
+				const auto esp = split_param[kESP];
 
 				auto dataHandler = RE::TESDataHandler::GetSingleton();
-				if (dataHandler) {
-					if (const auto form = dataHandler->LookupForm(formID, esp); form) {
+				if (formID && !esp.empty() && dataHandler) {
+					if (const auto form = dataHandler->LookupForm(*formID, esp); form) {
 						a_param = form;
 						result = true;
 					}
@@ -645,95 +204,77 @@ namespace Condition
 		return result;
 	}
 
+
+	auto ParseCondition(std::string_view a_condition, ConditionData& a_data) -> ParseResult
+	{
+		using OPCODE = RE::CONDITION_ITEM_DATA::OpCode;
+
+		auto& [conditionItem, functionID, param1, param2, operationCode, floatVal, operatorVal] = a_data;
+
+		std::array<std::string_view, 7> fields;
+		const auto count = Split(a_condition, '|', fields);
+		if (count < fields.size()) {
+			return { STATUS::kMissingField, static_cast<TYPE>(count) };
+		}
+
+		const auto field = [&](TYPE a_type) {
+			return fields[to_underlying(a_type)];
+		};
+
+		//conditionItemObject
+		if (const auto obj = ToIndex(MAP::conditionObj_reverse, field(TYPE::kConditionItemObject)); obj) {
+			conditionItem = static_cast<OBJECT>(*obj);
+		} else {
+			return { STATUS::kInvalidValue, TYPE::kConditionItemObject };
+		}
+		if (conditionItem == OBJECT::kRef || conditionItem == OBJECT::kLinkedRef || conditionItem == OBJECT::kQuestAlias || conditionItem == OBJECT::kPackData || conditionItem == OBJECT::kEventData) {
+			return { STATUS::kUnsupportedValue, TYPE::kConditionItemObject };
+		}
+		//functionID
+		if (const auto funcID = ToIndex(MAP::funcID_reverse, field(TYPE::kFunctionID)); funcID) {
+			functionID = static_cast<FUNC_ID>(*funcID);
+		} else {
+			return { STATUS::kInvalidValue, TYPE::kFunctionID };
+		}
+		const auto [paramType1, paramType2] = GetFuncType(functionID);
+		//param1
+		if (const auto str = field(TYPE::kParam1); isStringValid(str) && !ParseVoidParams(str, param1, paramType1)) {
+			return { STATUS::kInvalidValue, TYPE::kParam1 };
+		}
+		//param2
+		if (const auto str = field(TYPE::kParam2); isStringValid(str) && !ParseVoidParams(str, param2, paramType2)) {
+			return { STATUS::kInvalidValue, TYPE::kParam2 };
+		}
+		//OPCode
+		if (const auto opCode = ToIndex(MAP::opCode_reverse, field(TYPE::kOPCode)); opCode) {
+			operationCode = static_cast<OPCODE>(*opCode);
+		} else {
+			return { STATUS::kInvalidValue, TYPE::kOPCode };
+		}
+		//float
+		if (const auto num = ToFloat(field(TYPE::kFloat)); num) {
+			floatVal = *num;
+		} else {
+			return { STATUS::kInvalidValue, TYPE::kFloat };
+		}
+		//operator
+		operatorVal = field(TYPE::kANDOR).find("OR"sv) != std::string_view::npos;
+
+		return { STATUS::kOK, TYPE::kConditionItemObject };
+	}
+
+
 	auto ParseConditions(const std::vector<RE::BSFixedString>& a_conditionList) -> ConditionDataVec
 	{
 		ConditionDataVec dataVec;
+		dataVec.reserve(a_conditionList.size());
 
 		for (auto& condition : a_conditionList) {
 			ConditionData data;
-			auto& [conditionItem, functionID, param1, param2, operationCode, floatVal, operatorVal] = data;
-
-			PARAMS paramPair = { std::nullopt, std::nullopt };
 
-			auto split_condition = STRING::split(condition.c_str(), " | ");
-			//conditionItemObject
-			try {
-				auto str = STRING::trim(split_condition.at(to_underlying(TYPE::kConditionItemObject)));
-				if (STRING::is_only_digit(str)) {
-					conditionItem = static_cast<OBJECT>(std::stoul(str));
-				} else {
-					frozen::string obj(str.data(), str.size());
-					conditionItem = static_cast<OBJECT>(MAP::conditionObj_reverse.at(obj));
-				}
-				if (conditionItem == OBJECT::kRef || conditionItem == OBJECT::kLinkedRef || conditionItem == OBJECT::kQuestAlias || conditionItem == OBJECT::kPackData || conditionItem == OBJECT::kEventData) {
-					continue;
-				}
-			} catch (...) {
-				continue;
-			}
-			//functionID
-			try {
-				auto str = STRING::trim(split_condition.at(to_underlying(TYPE::kFunctionID)));
-				if (STRING::is_only_digit(str)) {
-					functionID = static_cast<FUNC_ID>(std::stoul(str));
-				} else {
-					frozen::string funcID(str.data(), str.size());
-					functionID = static_cast<FUNC_ID>(MAP::funcID_reverse.at(funcID));
-				}
-				paramPair = GetFuncType(functionID);
-			} catch (...) {
-				continue;
-			}
-			//param1
-			try {
-				auto str = STRING::trim(split_condition.at(to_underlying(TYPE::kParam1)));
-				if (isStringValid(str)) {
-					auto result = ParseVoidParams(str, param1, paramPair.first);
-					if (!result) {
-						continue;
-					}
-				}
-			} catch (...) {
-				continue;
-			}
-			//param2
-			try {
-				auto str = STRING::trim(split_condition.at(to_underlying(TYPE::kParam2)));
-				if (isStringValid(str)) {
-					auto result = ParseVoidParams(str, param2, paramPair.second);
-					if (!result) {
-						continue;
-					}
-				}
-			} catch (...) {
-				continue;
-			}
-			//OPCode
-			try {
-				using OPCODE = RE::CONDITION_ITEM_DATA::OpCode;
-
-				auto str = STRING::trim(split_condition.at(to_underlying(TYPE::kOPCode)));
-				if (STRING::is_only_digit(str)) {
-					operationCode = static_cast<OPCODE>(std::stoul(str));
-				} else {
-					frozen::string opCode(str.data(), str.size());
-					operationCode = static_cast<OPCODE>(MAP::opCode_reverse.at(opCode));
-				}
-			} catch (...) {
-				continue;
-			}
-			//float
-			try {
-				auto str = STRING::trim(split_condition.at(to_underlying(TYPE::kFloat)));
-				floatVal = std::stof(str);
-			} catch (...) {
-				continue;
-			}
-			//operator
-			try {
-				auto str = STRING::trim(split_condition.at(to_underlying(TYPE::kANDOR)));
-				operatorVal = str.find("OR"sv) != std::string::npos;
-			} catch (...) {
+			const std::string_view str(condition.c_str(), condition.size());
+			if (const auto [status, field] = ParseCondition(str, data); status != STATUS::kOK) {
+				logger::warn("ParseConditions - {} ({}) : {}"sv, fieldNames[to_underlying(field)], statusNames[to_underlying(status)], str);
 				continue;
 			}
 
@@ -744,10 +285,10 @@ namespace Condition
 	}
 
 
-	auto BuildVoidParams(std::string& a_str, void* a_param, std::optional<PARAM_TYPE> a_type) -> bool
+	auto BuildVoidParams(fmt::memory_buffer& a_buffer, void* a_param, std::optional<PARAM_TYPE> a_type) -> bool
 	{
 		if (!a_type.has_value()) {
-			a_str += "NONE"sv;
+			Append(a_buffer, "NONE"sv);
 			return true;
 		}
 
@@ -757,7 +298,7 @@ namespace Condition
 		case PARAM_TYPE::kInt:
 			{
 				auto integer = static_cast<std::int32_t>(reinterpret_cast<intptr_t>(a_param));
-				a_str += std::to_string(integer);
+				fmt::format_to(std::back_inserter(a_buffer), "{}", integer);
 
 				result = true;
 			}
@@ -765,15 +306,15 @@ namespace Condition
 		case PARAM_TYPE::kFloat:
 			{
 				auto num = *reinterpret_cast<float*>(&a_param);
-				a_str += std::to_string(num);
+				fmt::format_to(std::back_inserter(a_buffer), "{:f}", num);
 
 				result = true;
 			}
 			break;
 		case PARAM_TYPE::kChar:
 			{
-				auto string = *static_cast<RE::BSFixedString*>(a_param);
-				a_str += string;
+				auto string = static_cast<RE::BSFixedString*>(a_param);
+				Append(a_buffer, string ? std::string_view(string->c_str(), string->size()) : "NONE"sv);
 
 				result = true;
 			}
@@ -781,7 +322,7 @@ namespace Condition
 		case PARAM_TYPE::kSex:
 			{
 				auto sex = static_cast<std::uint32_t>(reinterpret_cast<uintptr_t>(a_param));
-				a_str += sex == 0 ? "Male" : "Female";
+				Append(a_buffer, sex == 0 ? "Male"sv : "Female"sv);
 
 				result = true;
 			}
@@ -790,13 +331,8 @@ namespace Condition
 			{
 				auto av = static_cast<std::uint32_t>(reinterpret_cast<uintptr_t>(a_param));
 
-				auto avList = RE::ActorValueList::GetSingleton();
-				if (avList) {
-					auto info = avList->GetActorValue(static_cast<RE::ActorValue>(av));
-					if (info) {
-						a_str += info->enumName;
-					}
-				}
+				const auto& name = ActorValueNames::Get(static_cast<RE::ActorValue>(av));
+				Append(a_buffer, std::string_view(name.c_str(), name.size()));
 
 				result = true;
 			}
@@ -805,7 +341,7 @@ namespace Condition
 		case PARAM_TYPE::kActor:
 			{
 				auto player = reinterpret_cast<RE::PlayerCharacter*>(a_param);
-				a_str += player ? "PlayerRef"sv : "NONE"sv;
+				Append(a_buffer, player ? "PlayerRef"sv : "NONE"sv);
 
 				result = true;
 			}
@@ -844,17 +380,13 @@ namespace Condition
 			{
 				auto form = reinterpret_cast<RE::TESForm*>(a_param);
 				if (form) {
-					std::stringstream sstream;
-					sstream << "0x" << std::uppercase << std::hex << form->GetFormID();
-					const auto formID = sstream.str();
-					a_str += formID;
-					a_str.append(" ~ "sv);
-					auto owner = form->sourceFiles.array->front();
-					a_str.append(owner ? owner->fileName : "Skyrim.esm"sv);
+					const auto files = form->sourceFiles.array;
+					const auto owner = files && !files->empty() ? files->front() : nullptr;
+					fmt::format_to(std::back_inserter(a_buffer), "0x{:X} ~ {}", form->GetFormID(), owner ? owner->fileName : "Skyrim.esm");
 
 					result = true;
 				} else {
-					a_str.append("NONE"sv);
+					Append(a_buffer, "NONE"sv);
 				}
 			}
 			break;
@@ -865,88 +397,48 @@ namespace Condition
 		return result;
 	}
 
-	auto BuildConditions(RE::TESCondition* a_conditions) -> std::vector<RE::BSFixedString>
+	auto BuildConditions(const RE::TESCondition* a_conditions) -> std::vector<RE::BSFixedString>
 	{
-		using OPCODE = RE::CONDITION_ITEM_DATA::OpCode;
-
-		ConditionDataVec conditionVec;
-
-		if (a_conditions) {
-			auto tmp = a_conditions->head;
-			while (tmp != nullptr) {
-				ConditionData conditionData{
-					*tmp->data.object,
-					*tmp->data.functionData.function,
-					tmp->data.functionData.params[0],
-					tmp->data.functionData.params[1],
-					tmp->data.flags.opCode,
-					tmp->data.comparisonValue.f,
-					tmp->data.flags.isOR
-				};
-				conditionVec.emplace_back(conditionData);
-				tmp = tmp->next;
-			}
+		std::vector<RE::BSFixedString> vec;
+		if (!a_conditions) {
+			return vec;
 		}
 
-		if (conditionVec.empty()) {
-			return std::vector<RE::BSFixedString>();
-		}
+		//reused for every condition, fits a typical condition without touching the heap
+		fmt::memory_buffer buffer;
 
-		std::vector<RE::BSFixedString> vec;
-		vec.reserve(conditionVec.size());
+		for (auto item = a_conditions->head; item; item = item->next) {
+			const auto& data = item->data;
+			const auto functionID = *data.functionData.function;
 
-		for (auto& [conditionItem, functionID, param1, param2, operationCode, floatVal, operatorVal] : conditionVec) {
-			std::string condition;
+			buffer.clear();
 			//condition
-			auto condItem = static_cast<std::uint32_t>(conditionItem);
-			try {
-				condition += MAP::conditionObj.at(condItem).data();
-			} catch (...) {
-				condition += std::to_string(condItem);
-			}
-			condition.append(" | "sv);
+			AppendName(buffer, MAP::conditionObj, static_cast<std::uint32_t>(*data.object));
+			Append(buffer, " | "sv);
 			//functionID
-			auto funcID = static_cast<std::uint32_t>(functionID);
-			try {
-				condition += MAP::funcID.at(funcID).data();
-			} catch (...) {
-				condition += std::to_string(funcID);
-			}
+			AppendName(buffer, MAP::funcID, static_cast<std::uint32_t>(functionID));
 			const auto paramPair = GetFuncType(functionID);
+			Append(buffer, " | "sv);
 			//param1
-			condition.append(" | "sv);
-			try {
-				if (!BuildVoidParams(condition, param1, paramPair.first)) {
-					continue;
-				}
-			} catch (...) {
-				condition.append("NONE"sv);
+			if (!BuildVoidParams(buffer, data.functionData.params[0], paramPair.first)) {
+				continue;
 			}
-			condition.append(" | "sv);
+			Append(buffer, " | "sv);
 			//param2
-			try {
-				if (!BuildVoidParams(condition, param2, paramPair.second)) {
-					continue;
-				}
-			} catch (...) {
-				condition.append("NONE"sv);
+			if (!BuildVoidParams(buffer, data.functionData.params[1], paramPair.second)) {
+				continue;
 			}
-			condition.append(" | "sv);
+			Append(buffer, " | "sv);
 			//opCode
-			auto opCode = static_cast<std::uint32_t>(operationCode);
-			try {
-				condition += MAP::opCode.at(opCode).data();
-			} catch (...) {
-				condition += std::to_string(opCode);
-			}
-			condition.append(" | "sv);
+			AppendName(buffer, MAP::opCode, static_cast<std::uint32_t>(data.flags.opCode));
+			Append(buffer, " | "sv);
 			//floatVal
-			condition += std::to_string(std::roundf(floatVal));
-			condition.append(" | "sv);
+			fmt::format_to(std::back_inserter(buffer), "{:f}", std::roundf(data.comparisonValue.f));
+			Append(buffer, " | "sv);
 			//ANDOR
-			condition.append(operatorVal ? "OR"sv : "AND"sv);
+			Append(buffer, data.flags.isOR ? "OR"sv : "AND"sv);
 
-			vec.emplace_back(condition.c_str());
+			vec.emplace_back(std::string_view(buffer.data(), buffer.size()));
 		}
 
 		return vec;
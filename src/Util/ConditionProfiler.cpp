@@ -0,0 +1,128 @@
+#include "Util/ConditionProfiler.h"
+
+#include "Util/ConditionParser.h"
+
+
+namespace Condition
+{
+	namespace
+	{
+		template <class K>
+		auto Rank(const std::unordered_map<K, Profiler::Stats>& a_stats)
+		{
+			std::vector<std::pair<K, Profiler::Stats>> ranked(a_stats.begin(), a_stats.end());
+			std::sort(ranked.begin(), ranked.end(), [](const auto& a_lhs, const auto& a_rhs) {
+				return a_lhs.second.time > a_rhs.second.time;
+			});
+			return ranked;
+		}
+
+
+		std::string GetFunctionName(std::uint32_t a_functionID)
+		{
+			if (const auto it = MAP::funcID.find(a_functionID); it != MAP::funcID.end()) {
+				return std::string(it->second.data(), it->second.size());
+			}
+			return fmt::format("Function {}", a_functionID);
+		}
+
+
+		std::string GetFormName(RE::FormID a_formID)
+		{
+			const auto form = RE::TESForm::LookupByID(a_formID);
+			const auto name = form ? form->GetName() : nullptr;
+			return name && name[0] != '\0' ? fmt::format("{} [0x{:08X}]", name, a_formID) : fmt::format("[0x{:08X}]", a_formID);
+		}
+
+
+		std::string Format(std::string_view a_name, const Profiler::Stats& a_stats)
+		{
+			const auto ms = std::chrono::duration<double, std::milli>(a_stats.time).count();
+			const auto average = a_stats.evaluations > 0 ? ms * 1000.0 / a_stats.evaluations : 0.0;
+			return fmt::format("{} : {} evaluations ({} cached), {:.3f} ms, {:.2f} us avg", a_name, a_stats.evaluations, a_stats.cached, ms, average);
+		}
+	}
+
+
+	Profiler* Profiler::GetSingleton()
+	{
+		static Profiler singleton;
+		return &singleton;
+	}
+
+
+	void Profiler::SetEnabled(bool a_enable)
+	{
+		Locker locker(_lock);
+
+		if (a_enable && !_enabled) {
+			_functions.clear();
+			_forms.clear();
+		}
+		_enabled = a_enable;
+	}
+
+
+	bool Profiler::IsEnabled() const
+	{
+		return _enabled.load(std::memory_order_relaxed);
+	}
+
+
+	void Profiler::RecordFunction(std::uint32_t a_functionID, Clock::duration a_time)
+	{
+		Locker locker(_lock);
+
+		auto& stats = _functions[a_functionID];
+		stats.evaluations++;
+		stats.time += a_time;
+	}
+
+
+	void Profiler::RecordCachedFunction(std::uint32_t a_functionID)
+	{
+		Locker locker(_lock);
+
+		_functions[a_functionID].cached++;
+	}
+
+
+	void Profiler::RecordForm(const RE::TESForm* a_form, Clock::duration a_time)
+	{
+		Locker locker(_lock);
+
+		auto& stats = _forms[a_form->GetFormID()];
+		stats.evaluations++;
+		stats.time += a_time;
+	}
+
+
+	std::vector<std::string> Profiler::GetReport() const
+	{
+		Locker locker(_lock);
+
+		std::vector<std::string> report;
+		report.reserve(_functions.size() + _forms.size() + 2);
+
+		report.push_back(fmt::format("{} condition functions", _functions.size()));
+		for (const auto& [functionID, stats] : Rank(_functions)) {
+			report.push_back(Format(GetFunctionName(functionID), stats));
+		}
+
+		report.push_back(fmt::format("{} forms", _forms.size()));
+		for (const auto& [formID, stats] : Rank(_forms)) {
+			report.push_back(Format(GetFormName(formID), stats));
+		}
+
+		return report;
+	}
+
+
+	void Profiler::LogReport() const
+	{
+		logger::info("{:*^30}", "CONDITIONS"sv);
+		for (const auto& line : GetReport()) {
+			logger::info("{}"sv, line);
+		}
+	}
+}
@@ -0,0 +1,252 @@
+#include "Util/EffectLoader.h"
+
+#include "Util/ConditionCache.h"
+#include "Util/ConditionParser.h"
+
+#include <charconv>
+#include <execution>
+#include <fstream>
+
+
+namespace EffectLoader
+{
+	namespace
+	{
+		namespace fs = std::filesystem;
+		using Clock = std::chrono::steady_clock;
+
+
+		struct Definition
+		{
+			std::string file;
+			std::size_t line;
+			std::string text;
+
+			RE::MagicItem* item{ nullptr };
+			RE::EffectSetting* mgef{ nullptr };
+			float magnitude{ 0.0f };
+			std::uint32_t area{ 0 };
+			std::uint32_t duration{ 0 };
+			float cost{ 0.0f };
+			Condition::ConditionDataVec conditions;
+
+			std::string error;
+		};
+
+
+		auto Trim(std::string_view a_str) -> std::string_view
+		{
+			constexpr auto whitespace = " \t\n\r\f\v"sv;
+
+			const auto first = a_str.find_first_not_of(whitespace);
+			if (first == std::string_view::npos) {
+				return {};
+			}
+			const auto last = a_str.find_last_not_of(whitespace);
+			return a_str.substr(first, last - first + 1);
+		}
+
+
+		auto Split(std::string_view a_str, char a_delim) -> std::vector<std::string_view>
+		{
+			std::vector<std::string_view> fields;
+			while (true) {
+				const auto pos = a_str.find(a_delim);
+				fields.push_back(Trim(a_str.substr(0, pos)));
+				if (pos == std::string_view::npos) {
+					break;
+				}
+				a_str.remove_prefix(pos + 1);
+			}
+			return fields;
+		}
+
+
+		template <class T>
+		auto ToNumber(std::string_view a_str) -> std::optional<T>
+		{
+			T value{};
+			const auto end = a_str.data() + a_str.size();
+			const auto [ptr, ec] = std::from_chars(a_str.data(), end, value);
+			if (ec != std::errc() || ptr != end) {
+				return std::nullopt;
+			}
+			return value;
+		}
+
+
+		template <class T>
+		T* ToForm(std::string_view a_str, Condition::PARAM_TYPE a_type)
+		{
+			void* param = nullptr;
+			if (!Condition::ParseVoidParams(a_str, param, a_type)) {
+				return nullptr;
+			}
+			return static_cast<RE::TESForm*>(param)->As<T>();
+		}
+
+
+		auto GetFiles() -> std::vector<fs::path>
+		{
+			std::vector<fs::path> files;
+
+			std::error_code ec;
+			for (const auto& entry : fs::directory_iterator(R"(Data\SKSE\Plugins)", ec)) {
+				if (!entry.is_regular_file()) {
+					continue;
+				}
+				const auto name = entry.path().filename().string();
+				if (name.size() > "_PEFX.ini"sv.size() && _stricmp(name.c_str() + name.size() - "_PEFX.ini"sv.size(), "_PEFX.ini") == 0) {
+					files.push_back(entry.path());
+				}
+			}
+
+			//applied in a stable order, whatever order the filesystem lists them in
+			std::sort(files.begin(), files.end());
+
+			return files;
+		}
+
+
+		void Read(const fs::path& a_path, std::vector<Definition>& a_definitions)
+		{
+			std::ifstream file(a_path);
+			if (!file) {
+				logger::error("Failed to open {}"sv, a_path.filename().string());
+				return;
+			}
+
+			const auto name = a_path.filename().string();
+
+			std::string line;
+			for (std::size_t index = 1; std::getline(file, line); index++) {
+				std::string_view str(line);
+				str = Trim(str.substr(0, str.find(';')));
+				if (str.empty()) {
+					continue;
+				}
+				a_definitions.push_back({ name, index, std::string(str) });
+			}
+		}
+
+
+		// runs on worker threads, only reads game data
+		void Parse(Definition& a_def)
+		{
+			using PARAM_TYPE = Condition::PARAM_TYPE;
+
+			const auto pos = a_def.text.find('=');
+			if (pos == std::string::npos || Trim(std::string_view(a_def.text).substr(0, pos)) != "Effect"sv) {
+				a_def.error = "expected \"Effect = ...\"";
+				return;
+			}
+
+			const auto fields = Split(std::string_view(a_def.text).substr(pos + 1), ',');
+			if (fields.size() < 6) {
+				a_def.error = "missing fields";
+				return;
+			}
+
+			a_def.item = ToForm<RE::MagicItem>(fields[0], PARAM_TYPE::kMagicItem);
+			if (!a_def.item || !a_def.item->Is(RE::FormType::Spell) && !a_def.item->Is(RE::FormType::Enchantment)) {
+				a_def.error = "spell or enchantment not found";
+				return;
+			}
+			a_def.mgef = ToForm<RE::EffectSetting>(fields[1], PARAM_TYPE::kMagicEffect);
+			if (!a_def.mgef) {
+				a_def.error = "magic effect not found";
+				return;
+			}
+
+			const auto magnitude = ToNumber<float>(fields[2]);
+			const auto area = ToNumber<std::uint32_t>(fields[3]);
+			const auto duration = ToNumber<std::uint32_t>(fields[4]);
+			const auto cost = ToNumber<float>(fields[5]);
+			if (!magnitude || !area || !duration || !cost) {
+				a_def.error = "invalid magnitude, area, duration or cost";
+				return;
+			}
+			a_def.magnitude = *magnitude;
+			a_def.area = *area;
+			a_def.duration = *duration;
+			a_def.cost = *cost;
+
+			a_def.conditions.reserve(fields.size() - 6);
+			for (auto it = fields.begin() + 6; it != fields.end(); ++it) {
+				Condition::ConditionData data;
+				if (const auto [status, field] = Condition::ParseCondition(*it, data); status != Condition::STATUS::kOK) {
+					a_def.error = fmt::format("invalid condition \"{}\"", *it);
+					return;
+				}
+				a_def.conditions.push_back(data);
+			}
+		}
+
+
+		// same checks and result as AddMagicEffectToSpell/AddMagicEffectToEnchantment
+		bool Apply(const Definition& a_def)
+		{
+			const auto item = a_def.item;
+			const auto mgef = a_def.mgef;
+
+			if (mgef->data.castingType != item->GetCastingType() || mgef->data.delivery != item->GetDelivery()) {
+				logger::warn("{}({}) : casting or delivery types don't match"sv, a_def.file, a_def.line);
+				return false;
+			}
+
+			if (item->GetEffectIsMatch(mgef, a_def.magnitude, a_def.area, a_def.duration, a_def.cost)) {
+				return false;
+			}
+
+			const auto effect = new RE::Effect();
+			effect->effectItem.magnitude = a_def.magnitude;
+			effect->effectItem.area = a_def.area;
+			effect->effectItem.duration = a_def.duration;
+			effect->baseEffect = mgef;
+			effect->cost = a_def.cost;
+			effect->conditions.head = Condition::Cache::CreateChain(a_def.conditions);
+
+			item->effects.push_back(effect);
+
+			return true;
+		}
+	}
+
+
+	void Load()
+	{
+		const auto files = GetFiles();
+		if (files.empty()) {
+			return;
+		}
+
+		const auto start = Clock::now();
+
+		std::vector<Definition> definitions;
+		for (const auto& path : files) {
+			Read(path, definitions);
+		}
+
+		std::for_each(std::execution::par, definitions.begin(), definitions.end(), Parse);
+
+		const auto parsed = Clock::now();
+
+		std::size_t added = 0;
+		for (const auto& def : definitions) {
+			if (!def.error.empty()) {
+				logger::warn("{}({}) : {}"sv, def.file, def.line, def.error);
+				continue;
+			}
+			if (Apply(def)) {
+				added++;
+			}
+		}
+
+		const auto end = Clock::now();
+
+		const auto ms = [](auto a_duration) {
+			return std::chrono::duration<double, std::milli>(a_duration).count();
+		};
+		logger::info("Effect files : {} files, {} lines, {} effects added. Parsed in {:.3f} ms, applied in {:.3f} ms"sv, files.size(), definitions.size(), added, ms(parsed - start), ms(end - parsed));
+	}
+}
@@ -0,0 +1,447 @@
+#include "Util/FormIndex.h"
+
+#include "Util/ActorSnapshot.h"
+#include "Util/MemoryStats.h"
+
+
+namespace FormIndex
+{
+	namespace
+	{
+		constexpr std::size_t BITS = 64;
+
+
+		void Set(std::vector<std::uint64_t>& a_bitset, std::uint32_t a_index, bool a_value)
+		{
+			const auto mask = std::uint64_t(1) << (a_index % BITS);
+			auto& word = a_bitset[a_index / BITS];
+			word = a_value ? word | mask : word & ~mask;
+		}
+
+
+		std::string ToLower(std::string_view a_name)
+		{
+			std::string name(a_name);
+			std::transform(name.begin(), name.end(), name.begin(), [](unsigned char a_char) {
+				return static_cast<char>(std::tolower(a_char));
+			});
+			return name;
+		}
+
+
+		// the load order slot a form ID belongs to, as TESFile::IsFormInMod matches it
+		std::uint32_t GetModKey(RE::FormID a_formID)
+		{
+			const auto index = a_formID >> 24;
+			return index == 0xFE ? a_formID & 0xFFFFF000 : index << 24;
+		}
+
+
+		std::uint32_t GetModKey(const RE::TESFile* a_file)
+		{
+			return a_file->IsLight() ? 0xFE000000 | (static_cast<std::uint32_t>(a_file->smallFileCompileIndex) << 12) : static_cast<std::uint32_t>(a_file->compileIndex) << 24;
+		}
+
+
+		// load order slot -> plugin, for plugins in the load order
+		std::unordered_map<std::uint32_t, const RE::TESFile*> GetLoadedFiles(RE::TESDataHandler* a_dataHandler)
+		{
+			std::unordered_map<std::uint32_t, const RE::TESFile*> files;
+			for (const auto& file : a_dataHandler->files) {
+				if (file && file->compileIndex != 0xFF) {
+					files.emplace(GetModKey(file), file);
+				}
+			}
+			return files;
+		}
+	}
+
+
+	Keywords* Keywords::GetSingleton()
+	{
+		static Keywords singleton;
+		return &singleton;
+	}
+
+
+	std::optional<std::vector<RE::TESForm*>> Keywords::GetForms(RE::FormType a_formType, const std::vector<RE::BGSKeyword*>& a_keywords)
+	{
+		const auto slot = GetSlot(a_formType);
+		const auto dataHandler = RE::TESDataHandler::GetSingleton();
+		if (slot == kNone || !dataHandler) {
+			return std::nullopt;
+		}
+
+		std::vector<RE::TESForm*> matches;
+		if (GetMatches(slot, dataHandler->GetFormArray(a_formType).size(), a_keywords, matches) == kNone) {
+			return std::nullopt;
+		}
+		return matches;
+	}
+
+
+	void Keywords::Update(const RE::TESForm* a_form, const RE::BGSKeyword* a_keyword, bool a_add)
+	{
+		Results::GetSingleton()->Invalidate();
+		Actors::Snapshot::Invalidate();  //its keyword signatures are built from the forms' keyword arrays
+
+		const auto slot = GetSlot(a_form->GetFormType());
+		if (slot == kNone) {
+			return;
+		}
+
+		Locker locker(_lock);
+		if (!_built) {  //built from the current keyword arrays later
+			return;
+		}
+
+		auto& table = _tables[slot];
+		const auto it = table.positions.find(a_form->GetFormID());
+		if (it == table.positions.end()) {
+			return;
+		}
+
+		auto& bitset = table.keywords[a_keyword->GetFormID()];
+		bitset.resize((table.forms.size() + BITS - 1) / BITS);
+		Set(bitset, it->second, a_add);
+	}
+
+
+	std::size_t Keywords::GetSlot(RE::FormType a_formType)
+	{
+		const auto it = std::find(TYPES.begin(), TYPES.end(), a_formType);
+		return it != TYPES.end() ? static_cast<std::size_t>(it - TYPES.begin()) : kNone;
+	}
+
+
+	void Keywords::Build()
+	{
+		const auto dataHandler = RE::TESDataHandler::GetSingleton();
+		if (!dataHandler) {
+			return;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		BuildTable(_tables[GetSlot(RE::FormType::Spell)], dataHandler->GetFormArray<RE::SpellItem>());
+		BuildTable(_tables[GetSlot(RE::FormType::Race)], dataHandler->GetFormArray<RE::TESRace>());
+		BuildTable(_tables[GetSlot(RE::FormType::Enchantment)], dataHandler->GetFormArray<RE::EnchantmentItem>());
+		_built = true;
+
+		std::size_t forms = 0;
+		std::size_t keywords = 0;
+		for (const auto& table : _tables) {
+			forms += table.forms.size();
+			keywords += table.keywords.size();
+		}
+
+		const auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		logger::info("Indexed {} forms by {} keyword sets in {:.3f} ms"sv, forms, keywords, time);
+	}
+
+
+	template <class T>
+	void Keywords::BuildTable(Table& a_table, const RE::BSTArray<T*>& a_forms)
+	{
+		const auto size = static_cast<std::uint32_t>(a_forms.size());
+		const auto words = (size + BITS - 1) / BITS;
+
+		a_table.forms.assign(a_forms.begin(), a_forms.end());
+		a_table.positions.clear();
+		a_table.keywords.clear();
+
+		for (std::uint32_t i = 0; i < size; i++) {
+			const auto form = a_forms[i];
+			if (!form) {
+				continue;
+			}
+			a_table.positions.emplace(form->GetFormID(), i);
+
+			const auto keywordForm = form->As<RE::BGSKeywordForm>();
+			if (!keywordForm || !keywordForm->keywords) {
+				continue;
+			}
+			for (std::uint32_t k = 0; k < keywordForm->numKeywords; k++) {
+				if (const auto keyword = keywordForm->keywords[k]; keyword) {
+					auto& bitset = a_table.keywords[keyword->GetFormID()];
+					bitset.resize(words);
+					Set(bitset, i, true);
+				}
+			}
+		}
+	}
+
+
+	std::size_t Keywords::GetMatches(std::size_t a_slot, std::size_t a_size, const std::vector<RE::BGSKeyword*>& a_keywords, std::vector<RE::TESForm*>& a_matches)
+	{
+		Locker locker(_lock);
+
+		if (!_built) {
+			Build();
+		}
+
+		const auto& table = _tables[a_slot];
+		if (table.forms.size() != a_size) {
+			return kNone;
+		}
+
+		Bitset matches((a_size + BITS - 1) / BITS, 0);
+		for (const auto& keyword : a_keywords) {
+			if (!keyword) {
+				continue;
+			}
+			if (const auto it = table.keywords.find(keyword->GetFormID()); it != table.keywords.end()) {
+				for (std::size_t i = 0; i < it->second.size(); i++) {
+					matches[i] |= it->second[i];
+				}
+			}
+		}
+
+		for (std::size_t i = 0; i < matches.size(); i++) {
+			for (auto word = matches[i]; word != 0; word &= word - 1) {
+				unsigned long bit;
+				_BitScanForward64(&bit, word);
+				a_matches.push_back(table.forms[i * BITS + bit]);
+			}
+		}
+
+		return a_matches.size();
+	}
+
+
+	Plugins* Plugins::GetSingleton()
+	{
+		static Plugins singleton;
+		return &singleton;
+	}
+
+
+	void Plugins::Build()
+	{
+		const auto dataHandler = RE::TESDataHandler::GetSingleton();
+		if (!dataHandler || _built) {
+			return;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (const auto& file : dataHandler->files) {
+			if (file) {
+				_names.emplace(ToLower(file->fileName), file);
+			}
+		}
+
+		std::unordered_map<std::uint32_t, FormLists*> slots;
+		for (const auto& [key, file] : GetLoadedFiles(dataHandler)) {
+			slots.emplace(key, &_forms[file]);
+		}
+
+		const auto index = [&](const auto& a_forms) {
+			using T = std::remove_pointer_t<typename std::decay_t<decltype(a_forms)>::value_type>;
+			const auto slot = GetSlot(T::FORMTYPE);
+			for (const auto& form : a_forms) {
+				if (!form) {
+					continue;
+				}
+				if (const auto it = slots.find(GetModKey(form->GetFormID())); it != slots.end()) {
+					(*it->second)[slot].push_back(form);
+				}
+			}
+		};
+		index(dataHandler->GetFormArray<RE::SpellItem>());
+		index(dataHandler->GetFormArray<RE::TESRace>());
+		index(dataHandler->GetFormArray<RE::EnchantmentItem>());
+		index(dataHandler->GetFormArray<RE::TESObjectBOOK>());
+		_built = true;
+
+		const auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		logger::info("Indexed {} plugins ({} loaded) in {:.3f} ms"sv, _names.size(), _forms.size(), time);
+	}
+
+
+	const RE::TESFile* Plugins::LookupMod(std::string_view a_name) const
+	{
+		if (!_built) {
+			const auto dataHandler = RE::TESDataHandler::GetSingleton();
+			return dataHandler ? dataHandler->LookupModByName(a_name) : nullptr;
+		}
+
+		const auto it = _names.find(ToLower(a_name));
+		return it != _names.end() ? it->second : nullptr;
+	}
+
+
+	std::optional<std::vector<RE::TESForm*>> Plugins::GetForms(RE::FormType a_formType, const RE::TESFile* a_file) const
+	{
+		const auto slot = GetSlot(a_formType);
+		if (slot == kNone || !_built) {
+			return std::nullopt;
+		}
+
+		const auto it = _forms.find(a_file);
+		return it != _forms.end() ? it->second[slot] : std::vector<RE::TESForm*>{};
+	}
+
+
+	std::size_t Plugins::GetSlot(RE::FormType a_formType)
+	{
+		const auto it = std::find(TYPES.begin(), TYPES.end(), a_formType);
+		return it != TYPES.end() ? static_cast<std::size_t>(it - TYPES.begin()) : kNone;
+	}
+
+
+	Results* Results::GetSingleton()
+	{
+		static Results singleton;
+		return &singleton;
+	}
+
+
+	Results::Key Results::MakeKey(QUERY a_query, RE::FormType a_formType, const std::vector<RE::BGSKeyword*>& a_any, const std::vector<RE::BGSKeyword*>& a_all, const RE::TESFile* a_modInfo, bool a_playable)
+	{
+		const auto toIDs = [](const std::vector<RE::BGSKeyword*>& a_keywords) {
+			std::vector<RE::FormID> formIDs;
+			formIDs.reserve(a_keywords.size());
+			for (const auto& keyword : a_keywords) {
+				formIDs.push_back(keyword ? keyword->GetFormID() : 0);
+			}
+			std::sort(formIDs.begin(), formIDs.end());
+			formIDs.erase(std::unique(formIDs.begin(), formIDs.end()), formIDs.end());
+			return formIDs;
+		};
+
+		return { a_query, a_formType, toIDs(a_any), toIDs(a_all), a_modInfo, a_playable };
+	}
+
+
+	void Results::Invalidate()
+	{
+		Locker locker(_lock);
+		_generation++;
+		_results.clear();
+	}
+
+
+	std::pair<std::size_t, std::size_t> Results::GetMemoryUsage() const
+	{
+		Locker locker(_lock);
+
+		std::size_t bytes = MemoryStats::TREE_NODE_OVERHEAD;
+		for (const auto& [key, entry] : _results) {
+			bytes += MemoryStats::TREE_NODE_OVERHEAD + sizeof(std::pair<const Key, Entry>);
+			bytes += (key.any.capacity() + key.all.capacity()) * sizeof(RE::FormID);
+			bytes += entry.forms.capacity() * sizeof(RE::TESForm*);
+		}
+
+		return { _results.size(), bytes };
+	}
+
+
+	auto Results::GetStamps(RE::FormType a_formType) -> Entry
+	{
+		const auto stamp = [](const RE::BSTArray<RE::TESForm*>& a_forms) -> Stamp {
+			return { a_forms.size(), a_forms.empty() ? nullptr : a_forms.back() };
+		};
+
+		Entry entry{ {}, { 0, nullptr }, { 0, nullptr } };
+		if (const auto dataHandler = RE::TESDataHandler::GetSingleton(); dataHandler) {
+			entry.formArray = stamp(dataHandler->GetFormArray(a_formType));
+			entry.books = stamp(dataHandler->GetFormArray(RE::FormType::Book));
+		}
+		return entry;
+	}
+
+
+	std::optional<std::vector<RE::TESForm*>> Results::Find(const Key& a_key)
+	{
+		const auto current = GetStamps(a_key.formType);
+
+		Locker locker(_lock);
+
+		const auto it = _results.find(a_key);
+		if (it == _results.end()) {
+			return std::nullopt;
+		}
+
+		const auto& entry = it->second;
+		if (entry.formArray != current.formArray || entry.books != current.books) {
+			_results.erase(it);
+			return std::nullopt;
+		}
+
+		return entry.forms;
+	}
+
+
+	void Results::Insert(const Key& a_key, Entry a_entry, std::uint64_t a_generation)
+	{
+		Locker locker(_lock);
+
+		if (_generation != a_generation) {
+			return;
+		}
+
+		if (_results.size() >= MAX_ENTRIES) {
+			_results.clear();
+		}
+		_results.insert_or_assign(a_key, std::move(a_entry));
+	}
+
+
+	SpellTomes* SpellTomes::GetSingleton()
+	{
+		static SpellTomes singleton;
+		return &singleton;
+	}
+
+
+	void SpellTomes::Build()
+	{
+		const auto dataHandler = RE::TESDataHandler::GetSingleton();
+		if (!dataHandler || _built) {
+			return;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		const auto files = GetLoadedFiles(dataHandler);
+		for (const auto& book : dataHandler->GetFormArray<RE::TESObjectBOOK>()) {
+			if (!book || book->data.flags.none(RE::OBJ_BOOK::Flag::kTeachesSpell) || !book->data.teaches.spell) {
+				continue;
+			}
+
+			const Tome tome{ book, book->data.teaches.spell };
+			_tomes.push_back(tome);
+			_books[tome.spell].push_back(book);
+			if (const auto it = files.find(GetModKey(book->GetFormID())); it != files.end()) {
+				_plugins[it->second].push_back(tome);
+			}
+		}
+		_built = true;
+
+		const auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		logger::info("Indexed {} spell tomes teaching {} spells in {:.3f} ms"sv, _tomes.size(), _books.size(), time);
+	}
+
+
+	const std::vector<SpellTomes::Tome>& SpellTomes::GetTomes() const
+	{
+		return _tomes;
+	}
+
+
+	const std::vector<SpellTomes::Tome>& SpellTomes::GetTomes(const RE::TESFile* a_file) const
+	{
+		static const std::vector<Tome> none;
+
+		const auto it = _plugins.find(a_file);
+		return it != _plugins.end() ? it->second : none;
+	}
+
+
+	RE::TESObjectBOOK* SpellTomes::GetTome(const RE::SpellItem* a_spell) const
+	{
+		const auto it = _books.find(a_spell);
+		return it != _books.end() ? it->second.front() : nullptr;
+	}
+}
@@ -0,0 +1,44 @@
+#include "Util/Frame.h"
+
+
+namespace Frame
+{
+	namespace
+	{
+		std::atomic<std::uint64_t> index{ 0 };
+
+
+		class PlayerUpdate
+		{
+		public:
+			static void Install()
+			{
+				REL::Relocation<std::uintptr_t> vtbl{ REL::ID(261916) };  //PlayerCharacter vtbl
+				_Update = vtbl.write_vfunc(0x0AD, Update);
+			}
+
+		private:
+			static void Update(RE::PlayerCharacter* a_this, float a_delta)
+			{
+				index++;
+
+				_Update(a_this, a_delta);
+			}
+
+			static inline REL::Relocation<decltype(Update)> _Update;  // 0AD
+		};
+	}
+
+
+	std::uint64_t GetIndex()
+	{
+		return index;
+	}
+
+
+	void Install()
+	{
+		logger::info("Hooking Player Update"sv);
+		PlayerUpdate::Install();
+	}
+}
@@ -0,0 +1,169 @@
+#include "Util/MemoryStats.h"
+
+#include "Serialization/Events.h"
+#include "Serialization/Form/Keywords.h"
+#include "Serialization/Form/Perks.h"
+#include "Util/ConditionCache.h"
+#include "Util/FormIndex.h"
+
+
+namespace MemoryStats
+{
+	namespace
+	{
+		struct Counter
+		{
+			std::atomic<std::uint64_t> allocs{ 0 };
+			std::atomic<std::uint64_t> frees{ 0 };
+			std::atomic<std::uint64_t> bytes{ 0 };
+		};
+
+
+		std::array<Counter, to_underlying(TYPE::kTotal)> counters;
+
+
+		constexpr std::array<std::string_view, to_underlying(TYPE::kTotal)> names{
+			"Keywords"sv,
+			"Perks"sv,
+			"Registrations"sv,
+			"Queued events"sv,
+			"Extra data"sv,
+			"Condition lists"sv,
+			"Form queries"sv
+		};
+
+
+		std::size_t GetExtraDataSize(RE::NiExtraData* a_data)
+		{
+			if (const auto strings = netimmerse_cast<RE::NiStringsExtraData*>(a_data); strings) {
+				std::size_t size = sizeof(RE::NiStringsExtraData) + strings->size * sizeof(char*);
+				for (std::uint32_t i = 0; i < strings->size; i++) {
+					if (strings->value[i]) {
+						size += std::strlen(strings->value[i]) + 1;
+					}
+				}
+				return size;
+			}
+			if (netimmerse_cast<RE::NiIntegerExtraData*>(a_data)) {
+				return sizeof(RE::NiIntegerExtraData);
+			}
+			if (netimmerse_cast<RE::NiBooleanExtraData*>(a_data)) {
+				return sizeof(RE::NiBooleanExtraData);
+			}
+			return sizeof(RE::NiExtraData);
+		}
+
+
+		void GetExtraDataUsage(Entry& a_entry)
+		{
+			const auto TES = RE::TES::GetSingleton();
+			if (!TES) {
+				return;
+			}
+
+			TES->ForEachReference([&](RE::TESObjectREFR& a_ref) {
+				const auto root = a_ref.Get3D();
+				if (!root || !root->extra || root->extraDataSize == 0) {
+					return true;
+				}
+				stl::span<RE::NiExtraData*> span(root->extra, root->extraDataSize);
+				for (const auto& extraData : span) {
+					if (extraData && std::string_view(extraData->name).rfind("PO3_"sv, 0) == 0) {
+						a_entry.count++;
+						a_entry.bytes += GetExtraDataSize(extraData);
+					}
+				}
+				return true;
+			});
+		}
+	}
+
+
+	void Alloc(TYPE a_type, std::size_t a_size)
+	{
+		auto& counter = counters[to_underlying(a_type)];
+		counter.allocs++;
+		counter.bytes += a_size;
+	}
+
+
+	void Free(TYPE a_type, std::size_t a_size)
+	{
+		auto& counter = counters[to_underlying(a_type)];
+		counter.frees++;
+		counter.bytes -= a_size;
+	}
+
+
+	std::vector<Entry> GetStats(bool a_scanReferences)
+	{
+		using namespace Serialization;
+
+		std::vector<Entry> stats;
+		stats.reserve(names.size());
+
+		for (std::size_t i = 0; i < names.size(); i++) {
+			auto& counter = counters[i];
+			stats.push_back({ names[i], counter.allocs, counter.frees, 0, counter.bytes });
+		}
+
+		//snapshots - these are owned by containers, not counted per allocation
+		auto& keywords = stats[to_underlying(TYPE::kKeywords)];
+		std::tie(keywords.count, keywords.bytes) = Form::Keywords::GetSingleton()->GetMemoryUsage();
+
+		auto& perks = stats[to_underlying(TYPE::kPerks)];
+		std::tie(perks.count, perks.bytes) = Form::Perks::GetSingleton()->GetMemoryUsage();
+
+		auto& registrations = stats[to_underlying(TYPE::kRegistrations)];
+		ForEachRegistration([&](const auto* a_regs) {
+			registrations.count += a_regs->GetNumRegistrations();
+			registrations.bytes += a_regs->GetHeapSize();
+		});
+
+		auto& queued = stats[to_underlying(TYPE::kQueuedEvents)];
+		queued.count = queued.allocs - queued.frees;
+
+		if (a_scanReferences) {
+			GetExtraDataUsage(stats[to_underlying(TYPE::kExtraData)]);
+		}
+
+		auto& conditions = stats[to_underlying(TYPE::kConditions)];
+		std::tie(conditions.count, conditions.bytes) = Condition::Cache::GetSingleton()->GetMemoryUsage();
+
+		auto& queries = stats[to_underlying(TYPE::kFormQueries)];
+		std::tie(queries.count, queries.bytes) = FormIndex::Results::GetSingleton()->GetMemoryUsage();
+
+		return stats;
+	}
+
+
+	std::vector<std::string> GetReport(bool a_scanReferences)
+	{
+		std::vector<std::string> report;
+
+		std::uint64_t total = 0;
+		for (const auto& [name, allocs, frees, count, bytes] : GetStats(a_scanReferences)) {
+			if (!a_scanReferences && name == names[to_underlying(TYPE::kExtraData)]) {
+				continue;
+			}
+			if (allocs > 0) {
+				report.push_back(fmt::format("{} : {} live ({} queued / {} sent), {} bytes", name, count, allocs, frees, bytes));
+			} else {
+				report.push_back(fmt::format("{} : {} entries, {} bytes", name, count, bytes));
+			}
+			total += bytes;
+		}
+		report.push_back(fmt::format("Total : {} bytes", total));
+
+		return report;
+	}
+
+
+	void LogReport()
+	{
+		logger::info("{:*^30}", "MEMORY"sv);
+		for (const auto& line : GetReport(false)) {
+			logger::info("{}"sv, line);
+		}
+	}
+}
@@ -0,0 +1,414 @@
+#include "Util/Spatial.h"
+
+#include <xmmintrin.h>
+
+
+namespace Spatial
+{
+	namespace
+	{
+		constexpr std::size_t LANES = 4;
+
+		//padding sorts after every real actor
+		constexpr float FAR_AWAY = std::numeric_limits<float>::infinity();
+	}
+
+
+	void ActorPositions::Add(RE::Actor* a_actor)
+	{
+		const auto pos = a_actor->GetPosition();
+
+		_actors.push_back(a_actor);
+		_x.push_back(pos.x);
+		_y.push_back(pos.y);
+		_z.push_back(pos.z);
+	}
+
+
+	void ActorPositions::Finish()
+	{
+		const auto padded = (_actors.size() + LANES - 1) / LANES * LANES;
+		_x.resize(padded, FAR_AWAY);
+		_y.resize(padded, FAR_AWAY);
+		_z.resize(padded, FAR_AWAY);
+	}
+
+
+	const float* ActorPositions::GetSquaredDistances(const RE::NiPoint3& a_origin) const
+	{
+		//keeps its capacity, so repeated queries on this thread don't allocate
+		thread_local std::vector<float> distances;
+
+		const auto padded = _x.size();
+		distances.resize(padded);
+
+		const auto originX = _mm_set1_ps(a_origin.x);
+		const auto originY = _mm_set1_ps(a_origin.y);
+		const auto originZ = _mm_set1_ps(a_origin.z);
+
+		for (std::size_t i = 0; i < padded; i += LANES) {
+			const auto dx = _mm_sub_ps(_mm_loadu_ps(_x.data() + i), originX);
+			const auto dy = _mm_sub_ps(_mm_loadu_ps(_y.data() + i), originY);
+			const auto dz = _mm_sub_ps(_mm_loadu_ps(_z.data() + i), originZ);
+			const auto squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			_mm_storeu_ps(distances.data() + i, squared);
+		}
+
+		return distances.data();
+	}
+
+
+	std::size_t ActorPositions::GetNearest(const RE::NiPoint3& a_origin, const RE::TESObjectREFR* a_exclude, bool a_ignorePlayer) const
+	{
+		const auto distances = GetSquaredDistances(a_origin);
+
+		auto nearest = npos;
+		auto shortest = FAR_AWAY;
+		for (std::size_t i = 0; i < _actors.size(); i++) {
+			if (distances[i] < shortest && !IsSkipped(i, a_exclude, a_ignorePlayer)) {
+				shortest = distances[i];
+				nearest = i;
+			}
+		}
+		return nearest;
+	}
+
+
+	void ActorPositions::GetNearest(const RE::NiPoint3& a_origin, const RE::TESObjectREFR* a_exclude, bool a_ignorePlayer, std::size_t a_count, float a_radius, std::vector<RE::Actor*>& a_actors) const
+	{
+		thread_local std::vector<std::uint32_t> order;
+
+		const auto distances = GetSquaredDistances(a_origin);
+		const auto squaredRadius = a_radius > 0.0f ? a_radius * a_radius : FAR_AWAY;
+
+		order.clear();
+		for (std::uint32_t i = 0; i < _actors.size(); i++) {
+			if (distances[i] <= squaredRadius && !IsSkipped(i, a_exclude, a_ignorePlayer)) {
+				order.push_back(i);
+			}
+		}
+
+		const auto count = std::min(a_count, order.size());
+		std::partial_sort(order.begin(), order.begin() + count, order.end(), [&](std::uint32_t a_lhs, std::uint32_t a_rhs) {
+			return distances[a_lhs] < distances[a_rhs];
+		});
+
+		a_actors.reserve(a_actors.size() + count);
+		for (std::size_t i = 0; i < count; i++) {
+			a_actors.push_back(_actors[order[i]]);
+		}
+	}
+
+
+	void ActorPositions::GetInRange(const RE::NiPoint3& a_origin, const RE::TESObjectREFR* a_exclude, bool a_ignorePlayer, float a_radius, std::vector<RE::Actor*>& a_actors) const
+	{
+		const auto distances = GetSquaredDistances(a_origin);
+		const auto squaredRadius = a_radius * a_radius;
+
+		for (std::size_t i = 0; i < _actors.size(); i++) {
+			if (distances[i] <= squaredRadius && !IsSkipped(i, a_exclude, a_ignorePlayer)) {
+				a_actors.push_back(_actors[i]);
+			}
+		}
+	}
+
+
+	bool ActorPositions::IsSkipped(std::size_t a_index, const RE::TESObjectREFR* a_exclude, bool a_ignorePlayer) const
+	{
+		const auto actor = _actors[a_index];
+		return actor == a_exclude || a_ignorePlayer && actor->IsPlayerRef();
+	}
+
+
+	ReferenceGrid* ReferenceGrid::GetSingleton()
+	{
+		static ReferenceGrid singleton;
+		return &singleton;
+	}
+
+
+	void ReferenceGrid::Register()
+	{
+		auto events = RE::ScriptEventSourceHolder::GetSingleton();
+		if (!events) {
+			logger::critical("Failed to sink the reference grid"sv);
+			return;
+		}
+
+		events->AddEventSink<RE::TESCellAttachDetachEvent>(this);
+		events->AddEventSink<RE::TESMoveAttachDetachEvent>(this);
+		events->AddEventSink<RE::TESObjectLoadedEvent>(this);
+		_registered = true;
+
+		logger::info("Registered reference grid"sv);
+	}
+
+
+	void ReferenceGrid::ForEachReferenceInRange(RE::TESObjectREFR* a_origin, float a_radius, std::function<bool(RE::TESObjectREFR&)> a_callback)
+	{
+		const auto TES = RE::TES::GetSingleton();
+		if (!TES) {
+			return;
+		}
+
+		if (!_registered || !a_origin || a_radius <= 0.0f) {
+			TES->ForEachReferenceInRange(a_origin, a_radius, a_callback);
+			return;
+		}
+
+		std::vector<RE::FormID> candidates;
+		{
+			Locker locker(_lock);
+			candidates.reserve(_dynamic.size());
+			_grid.ForEachInRange(a_origin->GetPosition(), a_radius, [&](RE::FormID a_formID) {
+				candidates.push_back(a_formID);
+				return true;
+			});
+			candidates.insert(candidates.end(), _dynamic.begin(), _dynamic.end());
+			if (!_dynamic.count(PLAYER)) {  //the player moves between cells without attach events
+				candidates.push_back(PLAYER);
+			}
+		}
+
+		const auto origin = a_origin->GetPosition();
+		const auto squaredRadius = a_radius * a_radius;
+
+		//sky cell references don't attach, TES visits them directly
+		const auto skyCell = TES->worldSpace ? TES->worldSpace->GetSkyCell() : nullptr;
+
+		//callbacks run unlocked, the ref is looked up again in case it was deleted since it was filed
+		for (const auto& formID : candidates) {
+			const auto ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(formID);
+			const auto cell = ref ? ref->GetParentCell() : nullptr;
+			if (!cell || !cell->IsAttached() || cell == skyCell) {
+				continue;
+			}
+			if (origin.GetSquaredDistance(ref->GetPosition()) <= squaredRadius && !a_callback(*ref)) {
+				return;
+			}
+		}
+
+		if (skyCell) {
+			skyCell->ForEachReferenceInRange(origin, a_radius, a_callback);
+		}
+	}
+
+
+	void ReferenceGrid::Clear()
+	{
+		Locker locker(_lock);
+		_grid.Clear();
+		_fixed.clear();
+		_dynamic.clear();
+	}
+
+
+	auto ReferenceGrid::ProcessEvent(const RE::TESCellAttachDetachEvent* a_event, RE::BSTEventSource<RE::TESCellAttachDetachEvent>*) -> EventResult
+	{
+		if (a_event && a_event->reference) {
+			Locker locker(_lock);
+			a_event->attached ? Add(a_event->reference.get()) : Remove(a_event->reference->GetFormID());
+		}
+		return EventResult::kContinue;
+	}
+
+
+	auto ReferenceGrid::ProcessEvent(const RE::TESMoveAttachDetachEvent* a_event, RE::BSTEventSource<RE::TESMoveAttachDetachEvent>*) -> EventResult
+	{
+		if (a_event && a_event->movedRef) {
+			Locker locker(_lock);
+			a_event->isCellAttached ? Add(a_event->movedRef.get()) : Remove(a_event->movedRef->GetFormID());
+		}
+		return EventResult::kContinue;
+	}
+
+
+	// 3D reloads after a ref was moved, so it's filed again at its current position
+	auto ReferenceGrid::ProcessEvent(const RE::TESObjectLoadedEvent* a_event, RE::BSTEventSource<RE::TESObjectLoadedEvent>*) -> EventResult
+	{
+		if (a_event && a_event->loaded) {
+			const auto ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_event->formID);
+			const auto cell = ref ? ref->GetParentCell() : nullptr;
+			if (cell && cell->IsAttached()) {
+				Locker locker(_lock);
+				Add(ref);
+			}
+		}
+		return EventResult::kContinue;
+	}
+
+
+	bool ReferenceGrid::IsFixed(const RE::TESObjectREFR* a_ref)
+	{
+		if (a_ref->IsDynamicForm() || (a_ref->formFlags & RE::TESForm::RecordFlags::kPersistent) != 0) {
+			return false;
+		}
+
+		const auto base = a_ref->GetBaseObject();
+		if (!base) {
+			return false;
+		}
+
+		switch (base->GetFormType()) {
+		case RE::FormType::Static:
+		case RE::FormType::StaticCollection:
+		case RE::FormType::Tree:
+		case RE::FormType::Flora:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+
+	void ReferenceGrid::Add(RE::TESObjectREFR* a_ref)
+	{
+		const auto formID = a_ref->GetFormID();
+
+		Remove(formID);
+		if (IsFixed(a_ref)) {
+			const auto key = _grid.GetKey(a_ref->GetPosition());
+			_grid.Insert(key, formID);
+			_fixed.emplace(formID, key);
+		} else {
+			_dynamic.insert(formID);
+		}
+	}
+
+
+	void ReferenceGrid::Remove(RE::FormID a_formID)
+	{
+		if (const auto it = _fixed.find(a_formID); it != _fixed.end()) {
+			_grid.Erase(it->second, a_formID);
+			_fixed.erase(it);
+		}
+		_dynamic.erase(a_formID);
+	}
+
+
+	NavmeshGrid* NavmeshGrid::GetSingleton()
+	{
+		static NavmeshGrid singleton;
+		return &singleton;
+	}
+
+
+	void NavmeshGrid::Register()
+	{
+		auto events = RE::ScriptEventSourceHolder::GetSingleton();
+		if (!events) {
+			logger::critical("Failed to sink the navmesh grid"sv);
+			return;
+		}
+
+		events->AddEventSink<RE::TESCellAttachDetachEvent>(this);
+
+		logger::info("Registered navmesh grid"sv);
+	}
+
+
+	std::optional<RE::NiPoint3> NavmeshGrid::GetNearestVertex(RE::TESObjectCELL* a_cell, const RE::NiPoint3& a_origin, float a_radius)
+	{
+		if (!a_cell || !a_cell->navMeshes) {
+			return std::nullopt;
+		}
+
+		auto squaredDistance = a_radius > 0.0f ? a_radius * a_radius : std::numeric_limits<float>::infinity();
+		std::optional<RE::NiPoint3> nearest = std::nullopt;
+
+		Locker locker(_lock);
+		for (auto& navMesh : a_cell->navMeshes->navMeshes) {
+			if (navMesh) {
+				FindNearest(GetVertices(a_cell, navMesh.get()), a_origin, squaredDistance, nearest);
+			}
+		}
+
+		return nearest;
+	}
+
+
+	void NavmeshGrid::Clear()
+	{
+		Locker locker(_lock);
+		_navMeshes.clear();
+		_cells.clear();
+	}
+
+
+	// every reference in a cell detaches with it, the first one drops the cell's navmeshes
+	auto NavmeshGrid::ProcessEvent(const RE::TESCellAttachDetachEvent* a_event, RE::BSTEventSource<RE::TESCellAttachDetachEvent>*) -> EventResult
+	{
+		if (!a_event || a_event->attached || !a_event->reference) {
+			return EventResult::kContinue;
+		}
+
+		const auto cell = a_event->reference->GetParentCell();
+		if (!cell) {
+			return EventResult::kContinue;
+		}
+
+		Locker locker(_lock);
+		if (const auto it = _cells.find(cell->GetFormID()); it != _cells.end()) {
+			for (const auto& formID : it->second) {
+				_navMeshes.erase(formID);
+			}
+			_cells.erase(it);
+		}
+
+		return EventResult::kContinue;
+	}
+
+
+	void NavmeshGrid::FindNearest(const Vertices& a_vertices, const RE::NiPoint3& a_origin, float& a_squaredDistance, std::optional<RE::NiPoint3>& a_nearest)
+	{
+		if (a_vertices.grid.size() == 0) {
+			return;
+		}
+
+		//past this radius every column of the navmesh has been searched
+		const auto dx = std::max(std::abs(a_origin.x - a_vertices.min.x), std::abs(a_origin.x - a_vertices.max.x));
+		const auto dy = std::max(std::abs(a_origin.y - a_vertices.min.y), std::abs(a_origin.y - a_vertices.max.y));
+		const auto reach = std::sqrt(dx * dx + dy * dy);
+
+		for (auto radius = COLUMN_SIZE;; radius *= 2.0f) {
+			a_vertices.grid.ForEachInRange(a_origin, radius, [&](const RE::NiPoint3& a_vertex) {
+				if (const auto squaredDistance = a_origin.GetSquaredDistance(a_vertex); squaredDistance < a_squaredDistance) {
+					a_squaredDistance = squaredDistance;
+					a_nearest.emplace(a_vertex);
+				}
+				return true;
+			});
+
+			//anything closer than the nearest so far lies within this radius, and has been seen
+			if (a_squaredDistance <= radius * radius || radius >= reach) {
+				return;
+			}
+		}
+	}
+
+
+	auto NavmeshGrid::GetVertices(const RE::TESObjectCELL* a_cell, const RE::NavMesh* a_navMesh) -> const Vertices&
+	{
+		const auto formID = a_navMesh->GetFormID();
+		if (const auto it = _navMeshes.find(formID); it != _navMeshes.end()) {
+			return it->second;
+		}
+
+		auto& vertices = _navMeshes[formID];
+		_cells[a_cell->GetFormID()].push_back(formID);
+
+		constexpr auto max = std::numeric_limits<float>::max();
+		vertices.min = { max, max, 0.0f };
+		vertices.max = { -max, -max, 0.0f };
+
+		for (const auto& vertex : a_navMesh->vertices) {
+			const auto& pos = vertex.location;
+			vertices.grid.Insert(vertices.grid.GetKey(pos), pos);
+
+			vertices.min = { std::min(vertices.min.x, pos.x), std::min(vertices.min.y, pos.y), 0.0f };
+			vertices.max = { std::max(vertices.max.x, pos.x), std::max(vertices.max.y, pos.y), 0.0f };
+		}
+
+		return vertices;
+	}
+}
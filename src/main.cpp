@@ -1,6 +1,13 @@
 #include "Hooks/EventHook.h"
 #include "Papyrus/Registration.h"
 #include "Serialization/Manager.h"
+#include "Util/ActorSnapshot.h"
+#include "Util/ActorValueNames.h"
+#include "Util/ConditionCache.h"
+#include "Util/EffectLoader.h"
+#include "Util/FormIndex.h"
+#include "Util/Frame.h"
+#include "Util/Spatial.h"
 
 #include "Version.h"
 
@@ -53,12 +60,28 @@ void OnInit(SKSE::MessagingInterface::Message* a_msg)
 		break;
 	case SKSE::MessagingInterface::kDataLoaded:
 		{
+			ActorValueNames::Build();
+			FormIndex::Plugins::GetSingleton()->Build();
+			FormIndex::SpellTomes::GetSingleton()->Build();
+			EffectLoader::Load();
+
 			Papyrus::Events::RegisterScriptEvents();
 			Papyrus::Events::RegisterStoryEvents();
 
+			Spatial::ReferenceGrid::GetSingleton()->Register();
+			Spatial::NavmeshGrid::GetSingleton()->Register();
+
+			Frame::Install();
 			Hook::HookEvents();
 		}
 		break;
+	case SKSE::MessagingInterface::kPreLoadGame:
+		Spatial::ReferenceGrid::GetSingleton()->Clear();
+		Spatial::NavmeshGrid::GetSingleton()->Clear();
+		Actors::Snapshot::Invalidate();
+		Condition::Cache::GetSingleton()->Clear();
+		FormIndex::Results::GetSingleton()->Invalidate();
+		break;
 	default:
 		break;
 	}
@@ -123,6 +146,7 @@ extern "C" DLLEXPORT bool APIENTRY SKSEPlugin_Load(const SKSE::LoadInterface* a_
 		auto serialization = SKSE::GetSerializationInterface();
 		serialization->SetUniqueID(Serialization::kPapyrusExtender);
 		serialization->SetSaveCallback(Serialization::SaveCallback);
+		serialization->SetRevertCallback(Serialization::RevertCallback);
 		serialization->SetLoadCallback(Serialization::LoadCallback);
 
 	} catch (const std::exception& e) {